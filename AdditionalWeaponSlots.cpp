@@ -1,6 +1,7 @@
 #include "Global.h"
 
 #include "TemporalSystem.h"
+#include "Resources.h"
 
 static GL_Primitive *moreTargetIcon[6];
 static GL_Primitive *moreTargetIconYellow[6];
@@ -122,6 +123,24 @@ HOOK_METHOD(CombatControl, OnRenderCombat, () -> void)
     }
 }
 
+static ImageHandle mouseTemporalSlow("mouse/mouse_temporal_slow.png");
+static ImageHandle mouseTemporalSlowValid("mouse/mouse_temporal_slow_valid.png");
+static ImageHandle mouseTemporalSpeed("mouse/mouse_temporal_speed.png");
+static ImageHandle mouseTemporalSpeedValid("mouse/mouse_temporal_speed_valid.png");
+static ImageHandle mouseMind("mouse/mouse_mind.png");
+static ImageHandle mouseMindValid("mouse/mouse_mind_valid.png");
+static ImageHandle mouseTeleportIn1("mouse/mouse_teleport_in1.png");
+static ImageHandle mouseTeleportIn2("mouse/mouse_teleport_in2.png");
+static ImageHandle mouseTeleportOut1("mouse/mouse_teleport_out1.png");
+static ImageHandle mouseTeleportOut2("mouse/mouse_teleport_out2.png");
+static ImageHandle mouseHacking("mouse/mouse_hacking.png");
+static ImageHandle mouseHackingValid("mouse/mouse_hacking_valid.png");
+static ImageHandle mouseCrosshairs("mouse/mouse_crosshairs.png");
+static ImageHandle mouseCrosshairsValid("mouse/mouse_crosshairs_valid.png");
+static ImageHandle mouseCrosshairsValid2("mouse/mouse_crosshairs_valid2.png");
+static NumberedImageHandle mouseCrosshairsEnemy("mouse/mouse_crosshairs2_", ".png");
+static NumberedImageHandle mouseCrosshairsSelf("mouse/mouse_crosshairs3_", ".png");
+
 HOOK_METHOD_PRIORITY(MouseControl, OnRender, 9999, () -> void)
 {
     LOG_HOOK("HOOK_METHOD_PRIORITY -> MouseControl::OnRender -> Begin (AdditionalWeaponSlots.cpp)\n")
@@ -144,7 +163,7 @@ HOOK_METHOD_PRIORITY(MouseControl, OnRender, 9999, () -> void)
         return;
     }
 
-    std::string s;
+    ImageHandle *handle = nullptr;
     GL_Texture *tex = nullptr;
     GL_Texture *tex2 = nullptr;
 
@@ -152,31 +171,31 @@ HOOK_METHOD_PRIORITY(MouseControl, OnRender, 9999, () -> void)
     {
         if (g_iTemporal == TEMPORAL_ARM_SLOW)
         {
-            s = valid ? "mouse/mouse_temporal_slow.png" : "mouse/mouse_temporal_slow_valid.png";
+            handle = valid ? &mouseTemporalSlow : &mouseTemporalSlowValid;
         }
         else
         {
-            s = valid ? "mouse/mouse_temporal_speed.png" : "mouse/mouse_temporal_speed_valid.png";
+            handle = valid ? &mouseTemporalSpeed : &mouseTemporalSpeedValid;
         }
     }
     else if (iMindControlling)
     {
-        s = valid ? "mouse/mouse_mind.png" : "mouse/mouse_mind_valid.png";
+        handle = valid ? &mouseMind : &mouseMindValid;
     }
     else if (iTeleporting)
     {
         if (iTeleporting == 2)
         {
-            s = valid ? "mouse/mouse_teleport_in1.png" : "mouse/mouse_teleport_in2.png";
+            handle = valid ? &mouseTeleportIn1 : &mouseTeleportIn2;
         }
         else
         {
-            s = valid ? "mouse/mouse_teleport_out1.png" : "mouse/mouse_teleport_out2.png";
+            handle = valid ? &mouseTeleportOut1 : &mouseTeleportOut2;
         }
     }
     else if (iHacking)
     {
-        s = valid ? "mouse/mouse_hacking.png" : "mouse/mouse_hacking_valid.png";
+        handle = valid ? &mouseHacking : &mouseHackingValid;
     }
     else if (bSellingStuff)
     {
@@ -186,22 +205,22 @@ HOOK_METHOD_PRIORITY(MouseControl, OnRender, 9999, () -> void)
     {
         if (aiming_required < 0)
         {
-            s = "mouse/mouse_crosshairs3_" + std::to_string(-aiming_required) + ".png";
-            tex2 = G_->GetResources()->GetImageId(valid ? "mouse/mouse_crosshairs.png" : "mouse/mouse_crosshairs_valid2.png");
+            tex = mouseCrosshairsSelf.Get(-aiming_required);
+            tex2 = valid ? mouseCrosshairs.Get() : mouseCrosshairsValid2.Get();
         }
         else
         {
-            s = "mouse/mouse_crosshairs2_" + std::to_string(aiming_required) + ".png";
-            tex2 = G_->GetResources()->GetImageId(valid ? "mouse/mouse_crosshairs.png" : "mouse/mouse_crosshairs_valid.png");
+            tex = mouseCrosshairsEnemy.Get(aiming_required);
+            tex2 = valid ? mouseCrosshairs.Get() : mouseCrosshairsValid.Get();
         }
     }
     else
     {
         tex = valid ? validPointer : invalidPointer;
     }
-    if (tex == nullptr)
+    if (handle)
     {
-        tex = G_->GetResources()->GetImageId(s);
+        tex = handle->Get();
     }
 
     if ((!bForceTooltip && tooltipTimer <= 0.15f) || tooltip.empty())
@@ -3,8 +3,8 @@
 
 #include "AlternateOxygenRendering.h"
 #include "CustomOptions.h"
+#include "XMLValue.h"
 
-#include <boost/lexical_cast.hpp>
 
 AlternateOxygenManager AlternateOxygenManager::instance = AlternateOxygenManager();
 
@@ -22,19 +22,19 @@ void AlternateOxygenManager::ParseGradientNode(rapidxml::xml_node<char> *node)
 
             if (child->first_attribute("r"))
             {
-                color.second.r = boost::lexical_cast<float>(child->first_attribute("r")->value()) / 255.f;
+                color.second.r = XMLValue::Attribute<float>(child, "r") / 255.f;
             }
             if (child->first_attribute("g"))
             {
-                color.second.g = boost::lexical_cast<float>(child->first_attribute("g")->value()) / 255.f;
+                color.second.g = XMLValue::Attribute<float>(child, "g") / 255.f;
             }
             if (child->first_attribute("b"))
             {
-                color.second.b = boost::lexical_cast<float>(child->first_attribute("b")->value()) / 255.f;
+                color.second.b = XMLValue::Attribute<float>(child, "b") / 255.f;
             }
             if (child->first_attribute("oxygen"))
             {
-                color.first = boost::lexical_cast<float>(child->first_attribute("oxygen")->value());
+                color.first = XMLValue::Attribute<float>(child, "oxygen");
             }
             oxygenGradient.push_back(color);
         }
@@ -1,4 +1,7 @@
 #include "Global.h"
+#include "Resources.h"
+
+static NumberedImageHandle artilleryBarImages("systemUI/button_artillery_", ".png");
 
 HOOK_METHOD(ArtilleryBox, OnRender, (bool ignoreStatus) -> void)
 {
@@ -12,7 +15,7 @@ HOOK_METHOD(ArtilleryBox, OnRender, (bool ignoreStatus) -> void)
     auto weapon = artSystem->projectileFactory;
 
     float frac = weapon->cooldown.first / weapon->cooldown.second;
-    auto backTex = G_->GetResources()->GetImageId("systemUI/button_artillery_" + std::to_string(power) + ".png");
+    auto backTex = artilleryBarImages.Get(power);
 
     CSurface::GL_BlitPixelImage(backTex, 0.f, 0.f, 23.f, 75.f, 0.f, COLOR_WHITE, false);
 
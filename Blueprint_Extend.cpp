@@ -76,3 +76,31 @@ HOOK_METHOD(BlueprintManager, ProcessDescription, (rapidxml::xml_node<char>* nod
     ret.baseRarity = ret.rarity; // fixes undefined behaviour when modder forgets blueprint rarity
     return ret;
 }
+
+std::unordered_map<std::string, const std::vector<std::string>*> BlueprintListRegistry::lists;
+
+const std::vector<std::string>* BlueprintListRegistry::GetList(const std::string& name)
+{
+    auto it = lists.find(name);
+    if (it != lists.end()) return it->second;
+
+    const std::map<std::string, std::vector<std::string>> &blueprintLists = G_->GetBlueprints()->blueprintLists;
+
+    const std::vector<std::string> *ret = nullptr;
+
+    auto listIt = blueprintLists.find(name);
+    if (listIt != blueprintLists.end()) ret = &listIt->second;
+
+    // blueprints.xml is fully loaded by then, so misses can be remembered too
+    if (G_->AreResourcesInitialized()) lists[name] = ret;
+
+    return ret;
+}
+
+const std::string* BlueprintListRegistry::Pick(const std::string& name)
+{
+    const std::vector<std::string> *list = GetList(name);
+    if (!list || list->empty()) return nullptr;
+
+    return &(*list)[random32() % list->size()];
+}
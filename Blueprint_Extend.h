@@ -1,5 +1,6 @@
 #pragma once
 #include "FTLGame.h"
+#include <unordered_map>
 
 /*
 struct WeaponBlueprint_Data
@@ -21,3 +22,19 @@ Blueprint_Extend* Get_Blueprint_Extend(const Blueprint* c);
 
 #define BP_EX Get_Blueprint_Extend
 */
+
+// Read-only views of BlueprintManager::blueprintLists.
+// BlueprintManager::GetBlueprintList returns a copy of the whole list, these return pointers into the manager's own map instead.
+class BlueprintListRegistry
+{
+public:
+    // nullptr if name is not a blueprint list
+    static const std::vector<std::string>* GetList(const std::string& name);
+
+    // Picks an entry with a single random32() draw, exactly like list[random32() % list.size()].
+    // Returns nullptr without drawing if name is not a non-empty blueprint list.
+    static const std::string* Pick(const std::string& name);
+
+private:
+    static std::unordered_map<std::string, const std::vector<std::string>*> lists;
+};
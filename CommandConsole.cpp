@@ -5,6 +5,7 @@
 #include "CustomEvents.h"
 #include "CustomScoreKeeper.h"
 #include "CustomAchievements.h"
+#include "Profiler.h"
 #include <boost/algorithm/string.hpp>
 #include <boost/lexical_cast.hpp>
 #include <cmath>
@@ -177,6 +178,24 @@ bool CommandConsole::RunCommand(CommandGui *commandGui, const std::string& cmd)
     {
         return true;
     }
+    if (cmdName == "PROFILE")
+    {
+        // Toggle timing; when switching off, write what was collected and start over
+        if (Profiler::Enabled())
+        {
+            Profiler::Enabled() = false;
+            if (Profiler::Dump(Profiler::FileName()))
+            {
+                hs_log_file("Profile written to %s\n", Profiler::FileName());
+            }
+            Profiler::Reset();
+        }
+        else
+        {
+            Profiler::Enabled() = true;
+        }
+        return true;
+    }
     if (command == "SHIP ALL")
     {
         CustomShipUnlocks::instance->UnlockAllShips();
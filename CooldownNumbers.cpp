@@ -1,5 +1,6 @@
 #include "CooldownNumbers.h"
 #include "CustomOptions.h"
+#include "CustomLocalization.h"
 
 HOOK_METHOD(WeaponBox, RenderBox, (bool dragging, bool flashPowerBox) -> void)
 {
@@ -29,18 +30,25 @@ HOOK_METHOD(WeaponBox, RenderBox, (bool dragging, bool flashPowerBox) -> void)
         {
             CSurface::GL_SetColor(GL_Color(150.f / 255.f, 150.f / 255.f, 150.f / 255.f, 1.f));
         }
-        std::stringstream stream;
+        float cooldownScale = 1 + pWeapon->GetAugmentationValue("AUTO_COOLDOWN");
+        float cooldown = pWeapon->cooldown.first / cooldownScale;
+        float cooldownMax = pWeapon->cooldown.second / cooldownScale;
+
+        // formatted into fixed buffers; "%.1f" and "%.3g" match the std::fixed/setprecision stream output
+        char buffer[64];
+        std::string streamStr;
         if (pWeapon->cooldown.first < 0)
         {
             CSurface::GL_SetColor(GL_Color(150.f / 255.f, 150.f / 255.f, 150.f / 255.f, 1.f));
-            stream << G_->GetTextLibrary()->GetText("weapon_cooldown_negative");
+            streamStr = TextLibraryCache::GetText("weapon_cooldown_negative");
         }
         else
         {
-            stream << std::fixed <<std::setprecision(1) << pWeapon->cooldown.first / (1 + pWeapon->GetAugmentationValue("AUTO_COOLDOWN")) << "/" << pWeapon->cooldown.second / (1 + pWeapon->GetAugmentationValue("AUTO_COOLDOWN"));
+            snprintf(buffer, sizeof(buffer), "%.1f/%.1f", cooldown, cooldownMax);
+            streamStr = buffer;
         }
-        
-        std::stringstream stream2;
+
+        std::string stream2Str;
         if (pWeapon->blueprint->boostPower.type == 2)
         {
             
@@ -58,17 +66,15 @@ HOOK_METHOD(WeaponBox, RenderBox, (bool dragging, bool flashPowerBox) -> void)
                     }
                 }
             }
-            stream2 << std::setprecision(3) << damage + boostLevel * pWeapon->blueprint->boostPower.amount << " " + G_->GetTextLibrary()->GetText("damage_word");
-            
+            snprintf(buffer, sizeof(buffer), "%.3g ", damage + boostLevel * pWeapon->blueprint->boostPower.amount);
+            stream2Str = buffer;
+            stream2Str += TextLibraryCache::GetText("damage_word");
         }
 
-        std::string streamStr = stream.str();
-        std::string stream2Str = stream2.str();
-        
         auto context = Global::GetInstance()->getLuaContext();
-        SWIG_NewPointerObj(context->GetLua(), pWeapon, context->getLibScript()->types.pProjectileFactory, 0);
-        lua_pushnumber(context->GetLua(), pWeapon->cooldown.first / (1 + pWeapon->GetAugmentationValue("AUTO_COOLDOWN")));
-        lua_pushnumber(context->GetLua(), pWeapon->cooldown.second / (1 + pWeapon->GetAugmentationValue("AUTO_COOLDOWN")));
+        LuaLibScript::push_cached_pointer(context->GetLua(), pWeapon, context->getLibScript()->types.pProjectileFactory);
+        lua_pushnumber(context->GetLua(), cooldown);
+        lua_pushnumber(context->GetLua(), cooldownMax);
         lua_pushstring(context->GetLua(), streamStr.c_str());
         lua_pushstring(context->GetLua(), stream2Str.c_str());
         bool preempt = context->getLibScript()->call_on_internal_chain_event_callbacks(InternalEvents::WEAPON_RENDERBOX, 5, 2);
@@ -81,83 +81,26 @@ template <class T> PowerReadyState ActivatedPower::PowerReqStatic(const T *power
         bool enemyBlackList = true;
         bool friendlyBlackList = true;
 
+        req->CompileSpeciesLists();
+
         for (auto i : currentShip->vCrewList)
         {
             if (i->iRoomId == power->crew->iRoomId && i != power->crew && !i->bDead)
             {
+                int speciesId = CM_EX(i)->GetSpeciesId();
+                whiteList = whiteList || req->whiteListSet.Contains(speciesId);
+
                 if (i->iShipId != ownerId)
                 {
                     enemyInRoom = true;
-                    if (!whiteList)
-                    {
-                        for (const std::string& race : req->whiteList)
-                        {
-                            if (i->species == race)
-                            {
-                                whiteList = true;
-                                break;
-                            }
-                        }
-                    }
-                    if (!enemyWhiteList)
-                    {
-                        for (const std::string& race : req->enemyWhiteList)
-                        {
-                            if (i->species == race)
-                            {
-                                enemyWhiteList = true;
-                                break;
-                            }
-                        }
-                    }
-                    if (enemyBlackList)
-                    {
-                        for (const std::string& race : req->enemyBlackList)
-                        {
-                            if (i->species == race)
-                            {
-                                enemyBlackList = false;
-                                break;
-                            }
-                        }
-                    }
+                    enemyWhiteList = enemyWhiteList || req->enemyWhiteListSet.Contains(speciesId);
+                    enemyBlackList = enemyBlackList && !req->enemyBlackListSet.Contains(speciesId);
                 }
                 else
                 {
                     friendlyInRoom = true;
-                    if (!whiteList)
-                    {
-                        for (const std::string& race : req->whiteList)
-                        {
-                            if (i->species == race)
-                            {
-                                whiteList = true;
-                                break;
-                            }
-                        }
-                    }
-                    if (!friendlyWhiteList)
-                    {
-                        for (const std::string& race : req->friendlyWhiteList)
-                        {
-                            if (i->species == race)
-                            {
-                                friendlyWhiteList = true;
-                                break;
-                            }
-                        }
-                    }
-                    if (friendlyBlackList)
-                    {
-                        for (const std::string& race : req->friendlyBlackList)
-                        {
-                            if (i->species == race)
-                            {
-                                friendlyBlackList = false;
-                                break;
-                            }
-                        }
-                    }
+                    friendlyWhiteList = friendlyWhiteList || req->friendlyWhiteListSet.Contains(speciesId);
+                    friendlyBlackList = friendlyBlackList && !req->friendlyBlackListSet.Contains(speciesId);
                 }
             }
         }
@@ -570,7 +513,7 @@ void ActivatedPower::ActivatePower()
     // Lua callback - has two arguments: ActivatedPower, ship
     auto context = Global::GetInstance()->getLuaContext();
     SWIG_NewPointerObj(context->GetLua(), this, context->getLibScript()->types.pActivatedPower, 0);
-    SWIG_NewPointerObj(context->GetLua(), ship, context->getLibScript()->types.pShipManager, 0);
+    LuaLibScript::push_cached_pointer(context->GetLua(), ship, context->getLibScript()->types.pShipManager);
 
     bool preempt = context->getLibScript()->call_on_internal_chain_event_callbacks(InternalEvents::ACTIVATE_POWER, 2, 0);
 
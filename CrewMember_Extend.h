@@ -244,6 +244,9 @@ public:
     std::string originalRace = "";
     std::string transformRace = "";
 
+    int speciesId = -1;
+    std::string speciesIdName = "";
+
     struct CustomTeleport
     {
         bool teleporting = false;
@@ -308,16 +311,46 @@ public:
     void UpdateAbilityStatBoosts(CrewDefinition *def);
     void UpdateAbilityStatBoosts();
 
-    std::pair<float,int> statCache[numCachedStats] = {};
+    // Stats computed during the current StatBoostManager::statCacheFrame; a frame change
+    // invalidates every entry at once by comparing statCacheFrame instead of a stamp per stat
+    static_assert(numCachedStats <= 64, "statCacheValid holds one bit per cached stat");
+    float statCacheValues[numCachedStats] = {};
+    uint64_t statCacheValid = 0;
+    unsigned int statCacheFrame = 0;
+
+    bool GetCachedStat(unsigned int stat, float &value) const
+    {
+        if (stat >= numCachedStats || statCacheFrame != StatBoostManager::statCacheFrame || !(statCacheValid & (1ULL << stat))) return false;
+        value = statCacheValues[stat];
+        return true;
+    }
+
+    void SetCachedStat(unsigned int stat, float value)
+    {
+        if (stat >= numCachedStats) return;
+        if (statCacheFrame != StatBoostManager::statCacheFrame)
+        {
+            statCacheFrame = StatBoostManager::statCacheFrame;
+            statCacheValid = 0;
+        }
+        statCacheValues[stat] = value;
+        statCacheValid |= 1ULL << stat;
+    }
 
     bool BoostCheck(StatBoost& statBoost, int checkRoomId=-1);
     bool CheckExtraCondition(CrewExtraCondition condition);
     int CalculateMaxHealth(const CrewDefinition* def);
     float CalculateStat(CrewStat stat, const CrewDefinition* def, bool* boolValue=nullptr);
     int CalculateDangerRating(float health, int roomId);
+    float CalculateDangerThreshold(int roomId);
+
+    // Highest active danger boost rating per room, valid for dangerThresholdFrame only
+    std::vector<float> dangerThresholds;
+    unsigned int dangerThresholdFrame = 0;
 
     std::string GetRace();
     CrewDefinition *GetDefinition();
+    int GetSpeciesId();
 
     float CalculateStat(CrewStat stat, bool* boolValue=nullptr)
     {
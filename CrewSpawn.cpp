@@ -1,5 +1,5 @@
 #include "CrewSpawn.h"
-#include <boost/lexical_cast.hpp>
+#include "XMLValue.h"
 
 std::vector<CrewSpawn*> CrewSpawn::crewSpawnDefs;
 
@@ -21,15 +21,15 @@ CrewSpawn *CrewSpawn::ParseCrewSpawn(rapidxml::xml_node<char>* node, bool isCrew
         }
         if (spawnName == "number")
         {
-            crewSpawn->number = boost::lexical_cast<int>(spawnNode->value());
+            crewSpawn->number = XMLValue::Value<int>(spawnNode);
         }
         if (spawnName == "healthPercentage")
         {
-            crewSpawn->healthPercentage = boost::lexical_cast<float>(spawnNode->value());
+            crewSpawn->healthPercentage = XMLValue::Value<float>(spawnNode);
         }
         if (spawnName == "lifetime")
         {
-            crewSpawn->lifetime = boost::lexical_cast<float>(spawnNode->value());
+            crewSpawn->lifetime = XMLValue::Value<float>(spawnNode);
         }
         if (spawnName == "statBoosts")
         {
@@ -2,8 +2,8 @@
 #include "CustomShipSelect.h"
 #include "Resources.h"
 #include "Seeds.h"
+#include "XMLValue.h"
 
-#include <boost/lexical_cast.hpp>
 
 CustomAchievementTracker* CustomAchievementTracker::instance = new CustomAchievementTracker();
 
@@ -318,7 +318,7 @@ void CustomAchievement::ParseAchievement(rapidxml::xml_node<char> *node, std::st
         {
             if (varName) *varName = child->first_attribute("name")->value();
 
-            ach.progress.second = boost::lexical_cast<int>(child->first_attribute("amount")->value());
+            ach.progress.second = XMLValue::Attribute<int>(child, "amount");
             ach.progress.first = 0;
         }
         if (nodeName == "multiDifficulty")
@@ -4,7 +4,7 @@
 #include "Global.h"
 #include "ShipManager_Extend.h"
 #include "CustomEvents.h"
-#include <boost/lexical_cast.hpp>
+#include "XMLValue.h"
 #include <boost/algorithm/string.hpp>
 
 CustomAugmentManager CustomAugmentManager::instance = CustomAugmentManager();
@@ -40,7 +40,7 @@ void CustomAugmentManager::ParseCustomAugmentNode(rapidxml::xml_node<char>* node
 
                             if (functionNode->first_attribute("value")) // Value of sub-augment
                             {
-                                func.value = boost::lexical_cast<float>(functionNode->first_attribute("value")->value());
+                                func.value = XMLValue::Attribute<float>(functionNode, "value");
                             }
                             if (functionNode->first_attribute("preferHigher")) // Use higher or lower value for non-stackable augments?
                             {
@@ -78,30 +78,30 @@ void CustomAugmentManager::ParseCustomAugmentNode(rapidxml::xml_node<char>* node
                         {
                             if (strcmp(child->name(), "value") == 0)
                             {
-                                augDef->superShield.value = boost::lexical_cast<int>(child->value());
+                                augDef->superShield.value = XMLValue::Value<int>(child);
                             }
                             if (strcmp(child->name(), "add") == 0)
                             {
-                                augDef->superShield.add = boost::lexical_cast<int>(child->value());
+                                augDef->superShield.add = XMLValue::Value<int>(child);
                             }
                             if (strcmp(child->name(), "color") == 0)
                             {
                                 augDef->superShield.customRender = true;
                                 if (child->first_attribute("r"))
                                 {
-                                    augDef->superShield.shieldColor.r = boost::lexical_cast<float>(child->first_attribute("r")->value()) / 255.f;
+                                    augDef->superShield.shieldColor.r = XMLValue::Attribute<float>(child, "r") / 255.f;
                                 }
                                 if (child->first_attribute("g"))
                                 {
-                                    augDef->superShield.shieldColor.g = boost::lexical_cast<float>(child->first_attribute("g")->value()) / 255.f;
+                                    augDef->superShield.shieldColor.g = XMLValue::Attribute<float>(child, "g") / 255.f;
                                 }
                                 if (child->first_attribute("b"))
                                 {
-                                    augDef->superShield.shieldColor.b = boost::lexical_cast<float>(child->first_attribute("b")->value()) / 255.f;
+                                    augDef->superShield.shieldColor.b = XMLValue::Attribute<float>(child, "b") / 255.f;
                                 }
                                 if (child->first_attribute("a"))
                                 {
-                                    augDef->superShield.shieldColor.a = boost::lexical_cast<float>(child->first_attribute("a")->value());
+                                    augDef->superShield.shieldColor.a = XMLValue::Attribute<float>(child, "a");
                                 }
                             }
                             if (strcmp(child->name(), "shieldImage") == 0)
@@ -132,11 +132,11 @@ void CustomAugmentManager::ParseCustomAugmentNode(rapidxml::xml_node<char>* node
                         }
                         if (functionNode->first_attribute("value"))
                         {
-                            shard.chance = boost::lexical_cast<float>(functionNode->first_attribute("value")->value());
+                            shard.chance = XMLValue::Attribute<float>(functionNode, "value");
                         }
                         if (functionNode->first_attribute("chance"))
                         {
-                            shard.chance = boost::lexical_cast<float>(functionNode->first_attribute("chance")->value());
+                            shard.chance = XMLValue::Attribute<float>(functionNode, "chance");
                         }
                         if (functionNode->first_attribute("stackable"))
                         {
@@ -354,7 +354,7 @@ HOOK_METHOD_PRIORITY(ShipObject, HasAugmentation, 2000, (const std::string& name
 
     // HAS_AUGMENTATION(ShipManager, name, augCount)
     auto context = G_->getLuaContext();
-    SWIG_NewPointerObj(context->GetLua(), G_->GetShipManager(this->iShipId), context->getLibScript()->types.pShipManager, 0);
+    LuaLibScript::push_cached_pointer(context->GetLua(), G_->GetShipManager(this->iShipId), context->getLibScript()->types.pShipManager);
     lua_pushstring(context->GetLua(), name.c_str());
     lua_pushinteger(context->GetLua(), augCount);
     context->getLibScript()->call_on_internal_chain_event_callbacks(InternalEvents::HAS_AUGMENTATION, 3, 1);
@@ -391,7 +391,7 @@ int HasAugmentationById(const std::string& name, int iShipId)
 
     // HAS_AUGMENTATION(ShipManager, name, augCount)
     auto context = G_->getLuaContext();
-    SWIG_NewPointerObj(context->GetLua(), G_->GetShipManager(iShipId), context->getLibScript()->types.pShipManager, 0);
+    LuaLibScript::push_cached_pointer(context->GetLua(), G_->GetShipManager(iShipId), context->getLibScript()->types.pShipManager);
     lua_pushstring(context->GetLua(), name.c_str());
     lua_pushinteger(context->GetLua(), augCount);
     context->getLibScript()->call_on_internal_chain_event_callbacks(InternalEvents::HAS_AUGMENTATION, 3, 1);
@@ -509,7 +509,7 @@ HOOK_METHOD(ShipObject, GetAugmentationValue, (const std::string& name) -> float
     float ret = super(name);
 
     auto context = G_->getLuaContext();
-    SWIG_NewPointerObj(context->GetLua(), G_->GetShipManager(this->iShipId), context->getLibScript()->types.pShipManager, 0);
+    LuaLibScript::push_cached_pointer(context->GetLua(), G_->GetShipManager(this->iShipId), context->getLibScript()->types.pShipManager);
     lua_pushstring(context->GetLua(), name.c_str());
     lua_pushnumber(context->GetLua(), ret);
     context->getLibScript()->call_on_internal_chain_event_callbacks(InternalEvents::GET_AUGMENTATION_VALUE, 3, 1); //Unsure what preempt would do here, if anything
@@ -1,6 +1,7 @@
 #include "CustomBackgroundObject.h"
 #include "CustomEvents.h"
-#include <boost/lexical_cast.hpp>
+#include "XMLValue.h"
+#include <algorithm>
 
 CustomBackgroundObjectManager* CustomBackgroundObjectManager::instance = new CustomBackgroundObjectManager();
 
@@ -55,26 +56,26 @@ CustomBackgroundObjectDefinition* CustomBackgroundObjectManager::ParseCustomBack
 
             if (child->first_attribute("z"))
             {
-                def->z = boost::lexical_cast<int>(child->first_attribute("z")->value());
+                def->z = XMLValue::Attribute<int>(child, "z");
             }
         }
         else if (strcmp(child->name(), "spawnArea") == 0)
         {
             if (child->first_attribute("x"))
             {
-                def->spawnArea.x = boost::lexical_cast<int>(child->first_attribute("x")->value());
+                def->spawnArea.x = XMLValue::Attribute<int>(child, "x");
             }
             if (child->first_attribute("y"))
             {
-                def->spawnArea.y = boost::lexical_cast<int>(child->first_attribute("y")->value());
+                def->spawnArea.y = XMLValue::Attribute<int>(child, "y");
             }
             if (child->first_attribute("w"))
             {
-                def->spawnArea.w = boost::lexical_cast<int>(child->first_attribute("w")->value());
+                def->spawnArea.w = XMLValue::Attribute<int>(child, "w");
             }
             if (child->first_attribute("h"))
             {
-                def->spawnArea.h = boost::lexical_cast<int>(child->first_attribute("h")->value());
+                def->spawnArea.h = XMLValue::Attribute<int>(child, "h");
             }
             if (child->first_attribute("center"))
             {
@@ -85,19 +86,19 @@ CustomBackgroundObjectDefinition* CustomBackgroundObjectManager::ParseCustomBack
         {
             if (child->first_attribute("x"))
             {
-                def->hitbox.x = boost::lexical_cast<int>(child->first_attribute("x")->value());
+                def->hitbox.x = XMLValue::Attribute<int>(child, "x");
             }
             if (child->first_attribute("y"))
             {
-                def->hitbox.y = boost::lexical_cast<int>(child->first_attribute("y")->value());
+                def->hitbox.y = XMLValue::Attribute<int>(child, "y");
             }
             if (child->first_attribute("w"))
             {
-                def->hitbox.w = boost::lexical_cast<int>(child->first_attribute("w")->value());
+                def->hitbox.w = XMLValue::Attribute<int>(child, "w");
             }
             if (child->first_attribute("h"))
             {
-                def->hitbox.h = boost::lexical_cast<int>(child->first_attribute("h")->value());
+                def->hitbox.h = XMLValue::Attribute<int>(child, "h");
             }
             if (child->first_attribute("center"))
             {
@@ -134,12 +135,12 @@ CustomBackgroundObjectDefinition* CustomBackgroundObjectManager::ParseCustomBack
             def->req = child->value();
             if (child->first_attribute("max_lvl"))
             {
-                def->max_lvl = boost::lexical_cast<int>(child->first_attribute("max_lvl")->value());
+                def->max_lvl = XMLValue::Attribute<int>(child, "max_lvl");
                 def->lvl = -2147483647;
             }
             if (child->first_attribute("lvl"))
             {
-                def->lvl = boost::lexical_cast<int>(child->first_attribute("lvl")->value());
+                def->lvl = XMLValue::Attribute<int>(child, "lvl");
             }
         }
         else if (strcmp(child->name(), "active") == 0)
@@ -170,9 +171,9 @@ CustomBackgroundObjectDefinition* CustomBackgroundObjectManager::ParseCustomBack
             CustomBackgroundObjectTimer &timerAction = def->timerActions.back();
 
             timerAction.action = ParseCustomBackgroundObjectAction(child);
-            if (child->first_attribute("time")) timerAction.time = boost::lexical_cast<float>(child->first_attribute("time")->value());
-            if (child->first_attribute("minTime")) timerAction.minTime = boost::lexical_cast<float>(child->first_attribute("minTime")->value())*1000;
-            if (child->first_attribute("maxTime")) timerAction.maxTime = boost::lexical_cast<float>(child->first_attribute("maxTime")->value())*1000;
+            if (child->first_attribute("time")) timerAction.time = XMLValue::Attribute<float>(child, "time");
+            if (child->first_attribute("minTime")) timerAction.minTime = XMLValue::Attribute<float>(child, "minTime")*1000;
+            if (child->first_attribute("maxTime")) timerAction.maxTime = XMLValue::Attribute<float>(child, "maxTime")*1000;
             if (child->first_attribute("loop")) timerAction.loop = EventsParser::ParseBoolean(child->first_attribute("loop")->value());
             if (child->first_attribute("requireActive")) timerAction.requireActive = EventsParser::ParseBoolean(child->first_attribute("requireActive")->value());
             if (child->first_attribute("requireHover")) timerAction.requireHover = EventsParser::ParseBoolean(child->first_attribute("requireHover")->value());
@@ -241,12 +242,12 @@ CustomBackgroundObjectAction CustomBackgroundObjectManager::ParseCustomBackgroun
             auto &transformDef = ret.newDef.back();
 
             transformDef.first = ParseCustomBackgroundObject(child);
-            transformDef.second = child->first_attribute("chance") ? boost::lexical_cast<int>(child->first_attribute("chance")->value()) : 1;
+            transformDef.second = child->first_attribute("chance") ? XMLValue::Attribute<int>(child, "chance") : 1;
             ret.newDefChance += transformDef.second;
         }
         else if (strcmp(child->name(), "noTransform") == 0)
         {
-            ret.newDefChance += child->first_attribute("chance") ? boost::lexical_cast<int>(child->first_attribute("chance")->value()) : 1;
+            ret.newDefChance += child->first_attribute("chance") ? XMLValue::Attribute<int>(child, "chance") : 1;
         }
         else if (strcmp(child->name(), "spawnObject") == 0)
         {
@@ -256,19 +257,19 @@ CustomBackgroundObjectAction CustomBackgroundObjectManager::ParseCustomBackgroun
 
             if (child->first_attribute("x"))
             {
-                spawnObject.second.x = boost::lexical_cast<int>(child->first_attribute("x")->value());
+                spawnObject.second.x = XMLValue::Attribute<int>(child, "x");
             }
             if (child->first_attribute("y"))
             {
-                spawnObject.second.y = boost::lexical_cast<int>(child->first_attribute("y")->value());
+                spawnObject.second.y = XMLValue::Attribute<int>(child, "y");
             }
             if (child->first_attribute("w"))
             {
-                spawnObject.second.w = boost::lexical_cast<int>(child->first_attribute("w")->value());
+                spawnObject.second.w = XMLValue::Attribute<int>(child, "w");
             }
             if (child->first_attribute("h"))
             {
-                spawnObject.second.h = boost::lexical_cast<int>(child->first_attribute("h")->value());
+                spawnObject.second.h = XMLValue::Attribute<int>(child, "h");
             }
             ret.spawnObjects.push_back(spawnObject);
         }
@@ -300,6 +301,7 @@ HOOK_METHOD(WorldManager, CreateLocation, (Location *location) -> void)
         if (starMap.locations[i] == location)
         {
             CustomBackgroundObjectManager::instance->currentLocationIndex = i;
+            CustomBackgroundObjectManager::instance->needSort = true;
             return super(location);
         }
     }
@@ -308,6 +310,7 @@ HOOK_METHOD(WorldManager, CreateLocation, (Location *location) -> void)
         if (starMap.locations[i] == starMap.currentLoc)
         {
             CustomBackgroundObjectManager::instance->currentLocationIndex = i;
+            CustomBackgroundObjectManager::instance->needSort = true;
             return super(location);
         }
     }
@@ -762,9 +765,18 @@ void CustomBackgroundObjectManager::OnRender(SpaceManager *space, int layer)
     tint.b = tint.g;
     tint.a = 1.f;
 
-    for (CustomBackgroundObject &backgroundObject : backgroundObjects[currentLocationIndex])
+    if (needSort) Sort();
+
+    // Objects are sorted by layer, so only the range for this layer needs to be visited
+    std::vector<CustomBackgroundObject> &objects = backgroundObjects[currentLocationIndex];
+    auto layerBegin = std::partition_point(objects.begin(), objects.end(),
+                                           [layer](const CustomBackgroundObject &obj) { return obj.def->layer < layer; });
+    auto layerEnd = std::partition_point(layerBegin, objects.end(),
+                                         [layer](const CustomBackgroundObject &obj) { return obj.def->layer <= layer; });
+
+    for (auto it = layerBegin; it != layerEnd; ++it)
     {
-        backgroundObject.OnRender(layer, tint);
+        it->OnRender(layer, tint);
     }
 }
 
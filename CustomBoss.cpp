@@ -1,6 +1,6 @@
 #include "CustomBoss.h"
 #include "CustomWeapons.h"
-#include <boost/lexical_cast.hpp>
+#include "XMLValue.h"
 #include <math.h>
 
 CustomBoss* CustomBoss::instance = new CustomBoss();
@@ -29,7 +29,7 @@ void CustomBoss::ParseBossNode(rapidxml::xml_node<char> *node)
 
                     if (crewNode->first_attribute("room"))
                     {
-                        roomId = boost::lexical_cast<int>(crewNode->first_attribute("room")->value());
+                        roomId = XMLValue::Attribute<int>(crewNode, "room");
                     }
 
                     auto crewDef = std::pair<std::string, int>(crewNode->name(), roomId);
@@ -95,14 +95,14 @@ void CustomBoss::ParseBossDroneNode(rapidxml::xml_node<char> *node, std::array<s
     {
         if (droneNode->first_attribute("difficulty"))
         {
-            int difficulty = boost::lexical_cast<int>(droneNode->first_attribute("difficulty")->value());
+            int difficulty = XMLValue::Attribute<int>(droneNode, "difficulty");
 
             if (difficulty > 2) continue;
 
             DroneCount droneCount = DroneCount();
 
             droneCount.drone = droneNode->first_attribute("name")->value();
-            droneCount.number = boost::lexical_cast<int>(droneNode->first_attribute("count")->value());
+            droneCount.number = XMLValue::Attribute<int>(droneNode, "count");
 
             (*def)[difficulty].push_back(droneCount);
         }
@@ -113,7 +113,7 @@ void CustomBoss::ParseBossDroneNode(rapidxml::xml_node<char> *node, std::array<s
                 DroneCount droneCount = DroneCount();
 
                 droneCount.drone = droneNode->first_attribute("name")->value();
-                droneCount.number = boost::lexical_cast<int>(droneNode->first_attribute("count")->value());
+                droneCount.number = XMLValue::Attribute<int>(droneNode, "count");
 
                 (*def)[difficulty].push_back(droneCount);
             }
@@ -127,14 +127,14 @@ void CustomBoss::ParseBossBarrageNode(rapidxml::xml_node<char> *node, std::array
     {
         if (child->first_attribute("difficulty"))
         {
-            int difficulty = boost::lexical_cast<int>(child->first_attribute("difficulty")->value());
+            int difficulty = XMLValue::Attribute<int>(child, "difficulty");
 
             if (difficulty > 2) continue;
 
             BarrageCount barrageCount = BarrageCount();
 
             barrageCount.weapon = child->first_attribute("name")->value();
-            barrageCount.number = boost::lexical_cast<int>(child->first_attribute("count")->value());
+            barrageCount.number = XMLValue::Attribute<int>(child, "count");
 
             (*def)[difficulty].push_back(barrageCount);
         }
@@ -145,7 +145,7 @@ void CustomBoss::ParseBossBarrageNode(rapidxml::xml_node<char> *node, std::array
                 BarrageCount barrageCount = BarrageCount();
 
                 barrageCount.weapon = child->first_attribute("name")->value();
-                barrageCount.number = boost::lexical_cast<int>(child->first_attribute("count")->value());
+                barrageCount.number = XMLValue::Attribute<int>(child, "count");
 
                 (*def)[difficulty].push_back(barrageCount);
             }
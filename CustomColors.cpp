@@ -3,7 +3,8 @@
 #include "Resources.h"
 #include "PALMemoryProtection.h"
 #include "CustomOptions.h"
-#include <boost/lexical_cast.hpp>
+#include "CustomLocalization.h"
+#include "XMLValue.h"
 
 GL_Color g_defaultTextButtonColors[4] =
 {
@@ -341,31 +342,31 @@ void ParseChoiceColorNode(rapidxml::xml_node<char>* node)
     ChoiceColor* choiceColor = new ChoiceColor;
     if (node->first_node("normal"))
     {
-        choiceColor->normal.r = boost::lexical_cast<float>(node->first_node("normal")->first_attribute("r")->value()) / 255.f;
-        choiceColor->normal.g = boost::lexical_cast<float>(node->first_node("normal")->first_attribute("g")->value()) / 255.f;
-        choiceColor->normal.b = boost::lexical_cast<float>(node->first_node("normal")->first_attribute("b")->value()) / 255.f;
-        if (node->first_node("normal")->first_attribute("a")) choiceColor->normal.a = boost::lexical_cast<float>(node->first_node("normal")->first_attribute("a")->value()) / 255.f;
+        choiceColor->normal.r = XMLValue::Attribute<float>(node->first_node("normal"), "r") / 255.f;
+        choiceColor->normal.g = XMLValue::Attribute<float>(node->first_node("normal"), "g") / 255.f;
+        choiceColor->normal.b = XMLValue::Attribute<float>(node->first_node("normal"), "b") / 255.f;
+        if (node->first_node("normal")->first_attribute("a")) choiceColor->normal.a = XMLValue::Attribute<float>(node->first_node("normal"), "a") / 255.f;
     }
     if (node->first_node("hover"))
     {
-        choiceColor->hover.r = boost::lexical_cast<float>(node->first_node("hover")->first_attribute("r")->value()) / 255.f;
-        choiceColor->hover.g = boost::lexical_cast<float>(node->first_node("hover")->first_attribute("g")->value()) / 255.f;
-        choiceColor->hover.b = boost::lexical_cast<float>(node->first_node("hover")->first_attribute("b")->value()) / 255.f;
-        if (node->first_node("hover")->first_attribute("a")) choiceColor->hover.a = boost::lexical_cast<float>(node->first_node("hover")->first_attribute("a")->value()) / 255.f;
+        choiceColor->hover.r = XMLValue::Attribute<float>(node->first_node("hover"), "r") / 255.f;
+        choiceColor->hover.g = XMLValue::Attribute<float>(node->first_node("hover"), "g") / 255.f;
+        choiceColor->hover.b = XMLValue::Attribute<float>(node->first_node("hover"), "b") / 255.f;
+        if (node->first_node("hover")->first_attribute("a")) choiceColor->hover.a = XMLValue::Attribute<float>(node->first_node("hover"), "a") / 255.f;
     }
     if (node->first_node("disabled"))
     {
-        choiceColor->disabled.r = boost::lexical_cast<float>(node->first_node("disabled")->first_attribute("r")->value()) / 255.f;
-        choiceColor->disabled.g = boost::lexical_cast<float>(node->first_node("disabled")->first_attribute("g")->value()) / 255.f;
-        choiceColor->disabled.b = boost::lexical_cast<float>(node->first_node("disabled")->first_attribute("b")->value()) / 255.f;
-        if (node->first_node("disabled")->first_attribute("a")) choiceColor->disabled.a = boost::lexical_cast<float>(node->first_node("disabled")->first_attribute("a")->value()) / 255.f;
+        choiceColor->disabled.r = XMLValue::Attribute<float>(node->first_node("disabled"), "r") / 255.f;
+        choiceColor->disabled.g = XMLValue::Attribute<float>(node->first_node("disabled"), "g") / 255.f;
+        choiceColor->disabled.b = XMLValue::Attribute<float>(node->first_node("disabled"), "b") / 255.f;
+        if (node->first_node("disabled")->first_attribute("a")) choiceColor->disabled.a = XMLValue::Attribute<float>(node->first_node("disabled"), "a") / 255.f;
     }
     if (node->first_node("blue_option"))
     {
-        choiceColor->blue_option.r = boost::lexical_cast<float>(node->first_node("blue_option")->first_attribute("r")->value()) / 255.f;
-        choiceColor->blue_option.g = boost::lexical_cast<float>(node->first_node("blue_option")->first_attribute("g")->value()) / 255.f;
-        choiceColor->blue_option.b = boost::lexical_cast<float>(node->first_node("blue_option")->first_attribute("b")->value()) / 255.f;
-        if (node->first_node("blue_option")->first_attribute("a")) choiceColor->blue_option.a = boost::lexical_cast<float>(node->first_node("blue_option")->first_attribute("a")->value()) / 255.f;
+        choiceColor->blue_option.r = XMLValue::Attribute<float>(node->first_node("blue_option"), "r") / 255.f;
+        choiceColor->blue_option.g = XMLValue::Attribute<float>(node->first_node("blue_option"), "g") / 255.f;
+        choiceColor->blue_option.b = XMLValue::Attribute<float>(node->first_node("blue_option"), "b") / 255.f;
+        if (node->first_node("blue_option")->first_attribute("a")) choiceColor->blue_option.a = XMLValue::Attribute<float>(node->first_node("blue_option"), "a") / 255.f;
     }
     
     ChoiceColorMap[name] = choiceColor;
@@ -505,9 +506,11 @@ HOOK_METHOD(WorldManager, CreateChoiceBox, (LocationEvent *event) -> void)
 HOOK_METHOD(TextLibrary, GetText, (const std::string &name, const std::string &lang) -> std::string)
 {
     LOG_HOOK("HOOK_METHOD -> TextLibrary::GetText -> Begin (CustomColors.cpp)\n")
-    if (!g_transferColorChoiceFlag_from_ID_to_realText) return super(name, lang);
-
     int pos = FindColorFlag(name);
     if (pos == -1 || pos > name.length()) return super(name, lang);
+
+    // ids with a color flag only resolve while a choice box is being created
+    TextLibraryCache::MarkVolatile();
+    if (!g_transferColorChoiceFlag_from_ID_to_realText) return super(name, lang);
     return super(name.substr(0, pos), lang) + name.substr(pos);
 }
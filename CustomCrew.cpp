@@ -9,6 +9,8 @@
 #include "ShipUnlocks.h"
 #include "CustomEvents.h"
 #include "CustomSystems.h"
+#include "XMLValue.h"
+#include "XMLTag.h"
 
 #include <boost/lexical_cast.hpp>
 #include <boost/algorithm/string.hpp>
@@ -36,6 +38,7 @@ bool g_showAllyPowers = false;
 int g_advancedCrewTooltipRounding = 2;
 
 CustomCrewManager CustomCrewManager::instance = CustomCrewManager();
+std::unordered_map<std::string, int> CustomCrewManager::speciesIds;
 
 void CustomCrewManager::AddCrewDefinition(CrewDefinition crew)
 {
@@ -130,119 +133,149 @@ void CustomCrewManager::ParseCrewNode(rapidxml::xml_node<char> *node)
                         std::string str = std::string(stat->name());
                         std::string val = std::string(stat->value());
 
-                        if (str == "canFight")
+                        switch (XMLTag::Hash(str))
+                        {
+                        HS_XML_TAG(str, "canFight")
                         {
                             crew.canFight = EventsParser::ParseBoolean(val);
                         }
-                        if (str == "controllable")
+                        break;
+                        HS_XML_TAG(str, "controllable")
                         {
                             crew.controllable = EventsParser::ParseBoolean(val);
                         }
-                        if (str == "selectable")
+                        break;
+                        HS_XML_TAG(str, "selectable")
                         {
                             crew.selectable = EventsParser::ParseBoolean(val);
                         }
-                        if (str == "canRepair")
+                        break;
+                        HS_XML_TAG(str, "canRepair")
                         {
                             crew.canRepair = EventsParser::ParseBoolean(val);
                         }
-                        if (str == "canSabotage")
+                        break;
+                        HS_XML_TAG(str, "canSabotage")
                         {
                             crew.canSabotage = EventsParser::ParseBoolean(val);
                         }
-                        if (str == "canMan")
+                        break;
+                        HS_XML_TAG(str, "canMan")
                         {
                             crew.canMan = EventsParser::ParseBoolean(val);
                         }
-                        if (str == "canTeleport")
+                        break;
+                        HS_XML_TAG(str, "canTeleport")
                         {
                             crew.canTeleport = EventsParser::ParseBoolean(val);
                         }
-                        if (str == "canSuffocate")
+                        break;
+                        HS_XML_TAG(str, "canSuffocate")
                         {
                             crew.canSuffocate = EventsParser::ParseBoolean(val);
                         }
-                        if (str == "canBurn")
+                        break;
+                        HS_XML_TAG(str, "canBurn")
                         {
                             crew.canBurn = EventsParser::ParseBoolean(val);
                         }
-                        if (str == "maxHealth")
+                        break;
+                        HS_XML_TAG(str, "maxHealth")
                         {
-                            crew.maxHealth = boost::lexical_cast<int>(val);
+                            crew.maxHealth = XMLValue::Value<int>(stat);
                         }
-                        if (str == "stunMultiplier")
+                        break;
+                        HS_XML_TAG(str, "stunMultiplier")
                         {
-                            crew.stunMultiplier = boost::lexical_cast<float>(val);
+                            crew.stunMultiplier = XMLValue::Value<float>(stat);
                         }
-                        if (str == "moveSpeedMultiplier")
+                        break;
+                        HS_XML_TAG(str, "moveSpeedMultiplier")
                         {
-                            crew.moveSpeedMultiplier = boost::lexical_cast<float>(val);
+                            crew.moveSpeedMultiplier = XMLValue::Value<float>(stat);
                         }
-                        if (str == "repairSpeed")
+                        break;
+                        HS_XML_TAG(str, "repairSpeed")
                         {
-                            crew.repairSpeed = boost::lexical_cast<float>(val);
+                            crew.repairSpeed = XMLValue::Value<float>(stat);
                         }
-                        if (str == "damageMultiplier")
+                        break;
+                        HS_XML_TAG(str, "damageMultiplier")
                         {
-                            crew.damageMultiplier = boost::lexical_cast<float>(val);
+                            crew.damageMultiplier = XMLValue::Value<float>(stat);
                         }
-                        if (str == "rangedDamageMultiplier")
+                        break;
+                        HS_XML_TAG(str, "rangedDamageMultiplier")
                         {
-                            crew.rangedDamageMultiplier = boost::lexical_cast<float>(val);
+                            crew.rangedDamageMultiplier = XMLValue::Value<float>(stat);
                         }
-                        if (str == "doorDamageMultiplier")
+                        break;
+                        HS_XML_TAG(str, "doorDamageMultiplier")
                         {
-                            crew.doorDamageMultiplier = boost::lexical_cast<float>(val);
+                            crew.doorDamageMultiplier = XMLValue::Value<float>(stat);
                         }
-                        if (str == "fireRepairMultiplier")
+                        break;
+                        HS_XML_TAG(str, "fireRepairMultiplier")
                         {
-                            crew.fireRepairMultiplier = boost::lexical_cast<float>(val);
+                            crew.fireRepairMultiplier = XMLValue::Value<float>(stat);
                         }
-                        if (str == "suffocationModifier")
+                        break;
+                        HS_XML_TAG(str, "suffocationModifier")
                         {
-                            crew.suffocationModifier = boost::lexical_cast<float>(val);
+                            crew.suffocationModifier = XMLValue::Value<float>(stat);
                         }
-                        if (str == "providesPower")
+                        break;
+                        HS_XML_TAG(str, "providesPower")
                         {
                             crew.providesPower = EventsParser::ParseBoolean(val);
                         }
-                        if (str == "bonusPower")
+                        break;
+                        HS_XML_TAG(str, "bonusPower")
                         {
-                            crew.bonusPower = boost::lexical_cast<int>(val);
+                            crew.bonusPower = XMLValue::Value<int>(stat);
                         }
-                        if (str == "isTelepathic")
+                        break;
+                        HS_XML_TAG(str, "isTelepathic")
                         {
                             crew.isTelepathic = EventsParser::ParseBoolean(val);
                         }
-                        if (str == "resistsMindControl")
+                        break;
+                        HS_XML_TAG(str, "resistsMindControl")
                         {
                             crew.resistsMindControl = EventsParser::ParseBoolean(val);
                         }
-                        if (str == "isAnaerobic")
+                        break;
+                        HS_XML_TAG(str, "isAnaerobic")
                         {
                             crew.isAnaerobic = EventsParser::ParseBoolean(val);
                         }
-                        if (str == "fireDamageMultiplier")
+                        break;
+                        HS_XML_TAG(str, "fireDamageMultiplier")
                         {
-                            crew.fireDamageMultiplier = boost::lexical_cast<float>(val);
+                            crew.fireDamageMultiplier = XMLValue::Value<float>(stat);
                         }
-                        if (str == "canPhaseThroughDoors")
+                        break;
+                        HS_XML_TAG(str, "canPhaseThroughDoors")
                         {
                             crew.canPhaseThroughDoors = EventsParser::ParseBoolean(val);
                         }
-                        if (str == "healSpeed")
+                        break;
+                        HS_XML_TAG(str, "healSpeed")
                         {
-                            crew.healSpeed = boost::lexical_cast<float>(val);
+                            crew.healSpeed = XMLValue::Value<float>(stat);
                         }
-                        if (str == "powerDrain")
+                        break;
+                        HS_XML_TAG(str, "powerDrain")
                         {
-                            crew.powerDrain = boost::lexical_cast<int>(val);
+                            crew.powerDrain = XMLValue::Value<int>(stat);
                         }
-                        if (str == "powerDrainFriendly")
+                        break;
+                        HS_XML_TAG(str, "powerDrainFriendly")
                         {
                             crew.powerDrainFriendly = EventsParser::ParseBoolean(val);
                         }
-                        if (str == "deathSounds")
+                        break;
+                        HS_XML_TAG(str, "deathSounds")
                         {
                             bool male = true;
                             bool female = true;
@@ -277,7 +310,8 @@ void CustomCrewManager::ParseCrewNode(rapidxml::xml_node<char> *node)
                                 }
                             }
                         }
-                        if (str == "shootingSounds")
+                        break;
+                        HS_XML_TAG(str, "shootingSounds")
                         {
                             for (auto shootingSoundNode = stat->first_node(); shootingSoundNode; shootingSoundNode = shootingSoundNode->next_sibling())
                             {
@@ -287,7 +321,8 @@ void CustomCrewManager::ParseCrewNode(rapidxml::xml_node<char> *node)
                                 }
                             }
                         }
-                        if (str == "repairSounds")
+                        break;
+                        HS_XML_TAG(str, "repairSounds")
                         {
                             crew.repairSounds.clear();
 
@@ -301,106 +336,123 @@ void CustomCrewManager::ParseCrewNode(rapidxml::xml_node<char> *node)
 
                             if (stat->first_attribute("animSoundFrame"))
                             {
-                                crew.repairSoundFrame = boost::lexical_cast<int>(stat->first_attribute("animSoundFrame")->value());
+                                crew.repairSoundFrame = XMLValue::Attribute<int>(stat, "animSoundFrame");
                             }
                         }
-                        if (str == "passiveStatBoosts")
+                        break;
+                        HS_XML_TAG(str, "passiveStatBoosts")
                         {
                             for (auto statBoostNode = stat->first_node(); statBoostNode; statBoostNode = statBoostNode->next_sibling())
                             {
                                 crew.passiveStatBoosts.push_back(StatBoostManager::GetInstance()->ParseStatBoostNode(statBoostNode, StatBoostDefinition::BoostSource::CREW, false));
                             }
                         }
-                        if (str == "animBase")
+                        break;
+                        HS_XML_TAG(str, "animBase")
                         {
                             crew.animBase = val;
                         }
-                        if (str == "animSheet")
+                        break;
+                        HS_XML_TAG(str, "animSheet")
                         {
                             crew.animSheet[0] = val;
                             crew.animSheet[1] = val;
                         }
-                        if (str == "animSheetFemale")
+                        break;
+                        HS_XML_TAG(str, "animSheetFemale")
                         {
                             crew.animSheet[0] = val;
                         }
-                        if (str == "shootTimer")
+                        break;
+                        HS_XML_TAG(str, "shootTimer")
                         {
                             if (!val.empty())
                             {
-                                crew.shootTimer.first = boost::lexical_cast<int>(val);
-                                crew.shootTimer.second = boost::lexical_cast<int>(val);
+                                crew.shootTimer.first = XMLValue::Value<int>(stat);
+                                crew.shootTimer.second = XMLValue::Value<int>(stat);
                             }
                             if (stat->first_attribute("min"))
                             {
-                                crew.shootTimer.first = boost::lexical_cast<int>(stat->first_attribute("min")->value());
-                                if (crew.shootTimer.second == -1) crew.shootTimer.second = boost::lexical_cast<int>(stat->first_attribute("min")->value());
+                                crew.shootTimer.first = XMLValue::Attribute<int>(stat, "min");
+                                if (crew.shootTimer.second == -1) crew.shootTimer.second = XMLValue::Attribute<int>(stat, "min");
                             }
                             if (stat->first_attribute("max"))
                             {
-                                crew.shootTimer.second = boost::lexical_cast<int>(stat->first_attribute("max")->value());
-                                if (crew.shootTimer.second == -1) crew.shootTimer.first = boost::lexical_cast<int>(stat->first_attribute("max")->value());
+                                crew.shootTimer.second = XMLValue::Attribute<int>(stat, "max");
+                                if (crew.shootTimer.second == -1) crew.shootTimer.first = XMLValue::Attribute<int>(stat, "max");
                             }
                         }
-                        if (str == "punchTimer")
+                        break;
+                        HS_XML_TAG(str, "punchTimer")
                         {
                             if (!val.empty())
                             {
-                                crew.punchTimer.first = boost::lexical_cast<int>(val);
-                                crew.punchTimer.second = boost::lexical_cast<int>(val);
+                                crew.punchTimer.first = XMLValue::Value<int>(stat);
+                                crew.punchTimer.second = XMLValue::Value<int>(stat);
                             }
                             if (stat->first_attribute("min"))
                             {
-                                crew.punchTimer.first = boost::lexical_cast<int>(stat->first_attribute("min")->value());
-                                if (crew.punchTimer.second == -1) crew.punchTimer.second = boost::lexical_cast<int>(stat->first_attribute("min")->value());
+                                crew.punchTimer.first = XMLValue::Attribute<int>(stat, "min");
+                                if (crew.punchTimer.second == -1) crew.punchTimer.second = XMLValue::Attribute<int>(stat, "min");
                             }
                             if (stat->first_attribute("max"))
                             {
-                                crew.punchTimer.second = boost::lexical_cast<int>(stat->first_attribute("max")->value());
-                                if (crew.punchTimer.second == -1) crew.punchTimer.first = boost::lexical_cast<int>(stat->first_attribute("max")->value());
+                                crew.punchTimer.second = XMLValue::Attribute<int>(stat, "max");
+                                if (crew.punchTimer.second == -1) crew.punchTimer.first = XMLValue::Attribute<int>(stat, "max");
                             }
                         }
-                        if (str == "canPunch")
+                        break;
+                        HS_XML_TAG(str, "canPunch")
                         {
                             crew.canPunch = EventsParser::ParseBoolean(val);
                         }
-                        if (str == "oxygenChangeSpeed")
+                        break;
+                        HS_XML_TAG(str, "oxygenChangeSpeed")
                         {
-                            crew.oxygenChangeSpeed = boost::lexical_cast<float>(val);
+                            crew.oxygenChangeSpeed = XMLValue::Value<float>(stat);
                         }
-                        if (str == "damageTakenMultiplier")
+                        break;
+                        HS_XML_TAG(str, "damageTakenMultiplier")
                         {
-                            crew.damageTakenMultiplier = boost::lexical_cast<float>(val);
+                            crew.damageTakenMultiplier = XMLValue::Value<float>(stat);
                         }
-                        if (str == "passiveHealAmount")
+                        break;
+                        HS_XML_TAG(str, "passiveHealAmount")
                         {
-                            crew.passiveHealAmount = boost::lexical_cast<float>(val);
+                            crew.passiveHealAmount = XMLValue::Value<float>(stat);
                         }
-                        if (str == "truePassiveHealAmount")
+                        break;
+                        HS_XML_TAG(str, "truePassiveHealAmount")
                         {
-                            crew.truePassiveHealAmount = boost::lexical_cast<float>(val);
+                            crew.truePassiveHealAmount = XMLValue::Value<float>(stat);
                         }
-                        if (str == "healAmount")
+                        break;
+                        HS_XML_TAG(str, "healAmount")
                         {
-                            crew.healAmount = boost::lexical_cast<float>(val);
+                            crew.healAmount = XMLValue::Value<float>(stat);
                         }
-                        if (str == "trueHealAmount")
+                        break;
+                        HS_XML_TAG(str, "trueHealAmount")
                         {
-                            crew.trueHealAmount = boost::lexical_cast<float>(val);
+                            crew.trueHealAmount = XMLValue::Value<float>(stat);
                         }
-                        if (str == "passiveHealDelay")
+                        break;
+                        HS_XML_TAG(str, "passiveHealDelay")
                         {
-                            crew.passiveHealDelay = boost::lexical_cast<int>(val);
+                            crew.passiveHealDelay = XMLValue::Value<int>(stat);
                         }
-                        if (str == "detectsLifeforms")
+                        break;
+                        HS_XML_TAG(str, "detectsLifeforms")
                         {
                             crew.detectsLifeforms = EventsParser::ParseBoolean(val);
                         }
-                        if (str == "healCrewAmount")
+                        break;
+                        HS_XML_TAG(str, "healCrewAmount")
                         {
-                            crew.healCrewAmount = boost::lexical_cast<float>(val);
+                            crew.healCrewAmount = XMLValue::Value<float>(stat);
                         }
-                        if (str == "skills")
+                        break;
+                        HS_XML_TAG(str, "skills")
                         {
                             for (auto skillNode = stat->first_node(); skillNode; skillNode = skillNode->next_sibling())
                             {
@@ -412,45 +464,54 @@ void CustomCrewManager::ParseCrewNode(rapidxml::xml_node<char> *node)
                                     {
                                         if (skillNode->first_attribute("req"))
                                         {
-                                            crew.skillsDef.skills[i].requirement = boost::lexical_cast<int>(skillNode->first_attribute("req")->value());
+                                            crew.skillsDef.skills[i].requirement = XMLValue::Attribute<int>(skillNode, "req");
                                         }
                                     }
                                 }
                             }
                         }
-                        if (str == "hasCustomDeathAnimation")
+                        break;
+                        HS_XML_TAG(str, "hasCustomDeathAnimation")
                         {
                             crew.hasCustomDeathAnimation = EventsParser::ParseBoolean(val);
                         }
-                        if (str == "sabotageSpeedMultiplier")
+                        break;
+                        HS_XML_TAG(str, "sabotageSpeedMultiplier")
                         {
-                            crew.sabotageSpeedMultiplier = boost::lexical_cast<float>(val);
+                            crew.sabotageSpeedMultiplier = XMLValue::Value<float>(stat);
                         }
-                        if (str == "defaultSkillLevel")
+                        break;
+                        HS_XML_TAG(str, "defaultSkillLevel")
                         {
-                            crew.defaultSkillLevel = boost::lexical_cast<int>(val);
+                            crew.defaultSkillLevel = XMLValue::Value<int>(stat);
                         }
-                        if (str == "cloneLoseSkills")
+                        break;
+                        HS_XML_TAG(str, "cloneLoseSkills")
                         {
                             crew.cloneLoseSkills = EventsParser::ParseBoolean(val);
                         }
-                        if (str == "allDamageTakenMultiplier")
+                        break;
+                        HS_XML_TAG(str, "allDamageTakenMultiplier")
                         {
-                            crew.allDamageTakenMultiplier = boost::lexical_cast<float>(val);
+                            crew.allDamageTakenMultiplier = XMLValue::Value<float>(stat);
                         }
-                        if (str == "damageEnemiesAmount")
+                        break;
+                        HS_XML_TAG(str, "damageEnemiesAmount")
                         {
-                            crew.damageEnemiesAmount = boost::lexical_cast<float>(val);
+                            crew.damageEnemiesAmount = XMLValue::Value<float>(stat);
                         }
-                        if (str == "hackDoors")
+                        break;
+                        HS_XML_TAG(str, "hackDoors")
                         {
                             crew.hackDoors = EventsParser::ParseBoolean(val);
                         }
-                        if (str == "powerRechargeMultiplier")
+                        break;
+                        HS_XML_TAG(str, "powerRechargeMultiplier")
                         {
-                            crew.powerRechargeMultiplier = boost::lexical_cast<float>(val);
+                            crew.powerRechargeMultiplier = XMLValue::Value<float>(stat);
                         }
-                        if (str == "nameRace")
+                        break;
+                        HS_XML_TAG(str, "nameRace")
                         {
                             crew.nameRace.push_back(stat->value());
                             if (stat->first_attribute("transformName"))
@@ -462,7 +523,8 @@ void CustomCrewManager::ParseCrewNode(rapidxml::xml_node<char> *node)
                                 crew.changeIfSame = EventsParser::ParseBoolean(stat->first_attribute("changeIfSame")->value());
                             }
                         }
-                        if (str == "droneAI")
+                        break;
+                        HS_XML_TAG(str, "droneAI")
                         {
                             crew.droneAI.hasCustomAI = true;
                             for (auto effectNode = stat->first_node(); effectNode; effectNode = effectNode->next_sibling())
@@ -491,84 +553,112 @@ void CustomCrewManager::ParseCrewNode(rapidxml::xml_node<char> *node)
                                 }
                             }
                         }
-                        if (str == "droneMoveFromManningSlot")
+                        break;
+                        HS_XML_TAG(str, "droneMoveFromManningSlot")
                         {
                             crew.droneMoveFromManningSlot = EventsParser::ParseBoolean(val);
                         }
-                        if (str == "deathEffect")
+                        break;
+                        HS_XML_TAG(str, "deathEffect")
                         {
                             crew.hasDeathExplosion = true;
                             ParseDeathEffect(stat, &crew.explosionDef);
                         }
-                        if (str == "powerEffect")
+                        break;
+                        HS_XML_TAG(str, "hasDeathExplosion")
+                        {
+                            // documented in hyperspace.xml, but hasDeathExplosion is set by <deathEffect> so the tag itself is ignored
+                        }
+                        break;
+                        HS_XML_TAG(str, "powerEffect")
                         {
                             ActivatedPowerDefinition *powerDef = ParseAbilityEffect(stat);
                             crew.powerDefs.push_back(powerDef);
                         }
-                        if (str == "powerResource")
+                        break;
+                        HS_XML_TAG(str, "powerResource")
                         {
                             ParseAbilityResource(stat); // doesn't get used directly for now, just allows it to be defined
                         }
-                        if (str == "crewSlots")
+                        break;
+                        HS_XML_TAG(str, "crewSlots")
                         {
-                            crew.crewSlots = boost::lexical_cast<float>(val);
+                            crew.crewSlots = XMLValue::Value<float>(stat);
                         }
-                        if (str == "noSlot")
+                        break;
+                        HS_XML_TAG(str, "noSlot")
                         {
                             crew.noSlot = EventsParser::ParseBoolean(val);
                         }
-                        if (str == "noClone")
+                        break;
+                        HS_XML_TAG(str, "noClone")
                         {
                             crew.noClone = EventsParser::ParseBoolean(val);
                         }
-                        if (str == "cloneSpeedMultiplier")
+                        break;
+                        HS_XML_TAG(str, "cloneSpeedMultiplier")
                         {
-                            crew.cloneSpeedMultiplier = boost::lexical_cast<float>(val);
+                            crew.cloneSpeedMultiplier = XMLValue::Value<float>(stat);
                         }
-                        if (str == "noAI")
+                        break;
+                        HS_XML_TAG(str, "noAI")
                         {
                             crew.noAI = EventsParser::ParseBoolean(val);
                         }
-                        if (str == "validTarget")
+                        break;
+                        HS_XML_TAG(str, "validTarget")
                         {
                             crew.validTarget = EventsParser::ParseBoolean(val);
                         }
-                        if (str == "canMove")
+                        break;
+                        HS_XML_TAG(str, "canMove")
                         {
                             crew.canMove = EventsParser::ParseBoolean(val);
                         }
-                        if (str == "snapToSlot")
+                        break;
+                        HS_XML_TAG(str, "snapToSlot")
                         {
                             crew.snapToSlot = EventsParser::ParseBoolean(val);
                         }
-                        if (str == "teleportMove")
+                        break;
+                        HS_XML_TAG(str, "teleportMove")
                         {
                             crew.teleportMove = EventsParser::ParseBoolean(val);
                         }
-                        if (str == "teleportMoveOtherShip")
+                        break;
+                        HS_XML_TAG(str, "teleportMoveOtherShip")
                         {
                             crew.teleportMoveOtherShip = EventsParser::ParseBoolean(val);
                         }
-                        if (str == "essential")
+                        break;
+                        HS_XML_TAG(str, "essential")
                         {
-                            crew.essential = boost::lexical_cast<float>(val);
+                            crew.essential = XMLValue::Value<float>(stat);
                         }
-                        if (str == "silenced")
+                        break;
+                        HS_XML_TAG(str, "silenced")
                         {
                             crew.silenced = EventsParser::ParseBoolean(val);
                         }
-                        if (str == "lowHealthThreshold")
+                        break;
+                        HS_XML_TAG(str, "lowHealthThreshold")
                         {
-                            crew.lowHealthThreshold = boost::lexical_cast<float>(val);
+                            crew.lowHealthThreshold = XMLValue::Value<float>(stat);
                         }
-                        if (str == "lowHealthThresholdPercentage")
+                        break;
+                        HS_XML_TAG(str, "lowHealthThresholdPercentage")
                         {
-                            crew.lowHealthThresholdPercentage = boost::lexical_cast<float>(val);
+                            crew.lowHealthThresholdPercentage = XMLValue::Value<float>(stat);
                         }
-                        if (str == "noWarning")
+                        break;
+                        HS_XML_TAG(str, "noWarning")
                         {
                             crew.noWarning = EventsParser::ParseBoolean(val);
                         }
+                        break;
+                        default:
+                            XMLTag::Unknown("crew", str);
+                        }
                     }
                 }
                 catch (boost::bad_lexical_cast const &e)
@@ -611,27 +701,27 @@ void CustomCrewManager::ParseDeathEffect(rapidxml::xml_node<char>* stat, Explosi
 
         if (effectName == "damage")
         {
-            def.damage.iDamage = boost::lexical_cast<int>(effectNode->value());
+            def.damage.iDamage = XMLValue::Value<int>(effectNode);
         }
         if (effectName == "fireChance")
         {
-            def.damage.fireChance = boost::lexical_cast<int>(effectNode->value());
+            def.damage.fireChance = XMLValue::Value<int>(effectNode);
         }
         if (effectName == "breachChance")
         {
-            def.damage.breachChance = boost::lexical_cast<int>(effectNode->value());
+            def.damage.breachChance = XMLValue::Value<int>(effectNode);
         }
         if (effectName == "ion")
         {
-            def.damage.iIonDamage = boost::lexical_cast<int>(effectNode->value());
+            def.damage.iIonDamage = XMLValue::Value<int>(effectNode);
         }
         if (effectName == "sysDamage")
         {
-            def.damage.iSystemDamage = boost::lexical_cast<int>(effectNode->value());
+            def.damage.iSystemDamage = XMLValue::Value<int>(effectNode);
         }
         if (effectName == "persDamage")
         {
-            def.damage.iPersDamage = boost::lexical_cast<int>(effectNode->value());
+            def.damage.iPersDamage = XMLValue::Value<int>(effectNode);
         }
         if (effectName == "hullBust")
         {
@@ -647,7 +737,7 @@ void CustomCrewManager::ParseDeathEffect(rapidxml::xml_node<char>* stat, Explosi
         }
         if (effectName == "stun")
         {
-            def.damage.iStun = boost::lexical_cast<int>(effectNode->value());
+            def.damage.iStun = XMLValue::Value<int>(effectNode);
         }
         if (effectName == "shipFriendlyFire")
         {
@@ -662,12 +752,12 @@ void CustomCrewManager::ParseDeathEffect(rapidxml::xml_node<char>* stat, Explosi
 
             if (effectNode->first_attribute("health"))
             {
-                def.transformRaceHealth = boost::lexical_cast<float>(effectNode->first_attribute("health")->value());
+                def.transformRaceHealth = XMLValue::Attribute<float>(effectNode, "health");
                 def.transformRaceHealthFraction = 0.f;
             }
             if (effectNode->first_attribute("healthFraction"))
             {
-                def.transformRaceHealthFraction = boost::lexical_cast<float>(effectNode->first_attribute("healthFraction")->value());
+                def.transformRaceHealthFraction = XMLValue::Attribute<float>(effectNode, "healthFraction");
             }
             if (effectNode->first_attribute("deathSound"))
             {
@@ -895,7 +985,7 @@ ActivatedPowerDefinition* CustomCrewManager::ParseAbilityEffect(rapidxml::xml_no
         }
         if (effectName == "initialCooldownFraction")
         {
-            def->initialCooldownFraction = boost::lexical_cast<float>(effectNode->value());
+            def->initialCooldownFraction = XMLValue::Value<float>(effectNode);
         }
         if (effectName == "onDeath")
         {
@@ -915,27 +1005,27 @@ ActivatedPowerDefinition* CustomCrewManager::ParseAbilityEffect(rapidxml::xml_no
         }
         if (effectName == "damage")
         {
-            def->damage.iDamage = boost::lexical_cast<int>(effectNode->value());
+            def->damage.iDamage = XMLValue::Value<int>(effectNode);
         }
         if (effectName == "fireChance")
         {
-            def->damage.fireChance = boost::lexical_cast<int>(effectNode->value());
+            def->damage.fireChance = XMLValue::Value<int>(effectNode);
         }
         if (effectName == "breachChance")
         {
-            def->damage.breachChance = boost::lexical_cast<int>(effectNode->value());
+            def->damage.breachChance = XMLValue::Value<int>(effectNode);
         }
         if (effectName == "ion")
         {
-            def->damage.iIonDamage = boost::lexical_cast<int>(effectNode->value());
+            def->damage.iIonDamage = XMLValue::Value<int>(effectNode);
         }
         if (effectName == "sysDamage")
         {
-            def->damage.iSystemDamage = boost::lexical_cast<int>(effectNode->value());
+            def->damage.iSystemDamage = XMLValue::Value<int>(effectNode);
         }
         if (effectName == "persDamage")
         {
-            def->damage.iPersDamage = boost::lexical_cast<int>(effectNode->value());
+            def->damage.iPersDamage = XMLValue::Value<int>(effectNode);
         }
         if (effectName == "hullBust")
         {
@@ -951,27 +1041,27 @@ ActivatedPowerDefinition* CustomCrewManager::ParseAbilityEffect(rapidxml::xml_no
         }
         if (effectName == "stun")
         {
-            def->damage.iStun = boost::lexical_cast<int>(effectNode->value());
+            def->damage.iStun = XMLValue::Value<int>(effectNode);
         }
         if (effectName == "cooldown")
         {
-            def->cooldown = boost::lexical_cast<float>(effectNode->value());
+            def->cooldown = XMLValue::Value<float>(effectNode);
         }
         if (effectName == "powerCharges")
         {
-            def->powerCharges = boost::lexical_cast<int>(effectNode->value());
+            def->powerCharges = XMLValue::Value<int>(effectNode);
         }
         if (effectName == "initialCharges")
         {
-            def->initialCharges = boost::lexical_cast<int>(effectNode->value());
+            def->initialCharges = XMLValue::Value<int>(effectNode);
         }
         if (effectName == "respawnCharges")
         {
-            def->respawnCharges = boost::lexical_cast<int>(effectNode->value());
+            def->respawnCharges = XMLValue::Value<int>(effectNode);
         }
         if (effectName == "chargesPerJump")
         {
-            def->chargesPerJump = boost::lexical_cast<int>(effectNode->value());
+            def->chargesPerJump = XMLValue::Value<int>(effectNode);
         }
         if (effectName == "shipFriendlyFire")
         {
@@ -983,7 +1073,7 @@ ActivatedPowerDefinition* CustomCrewManager::ParseAbilityEffect(rapidxml::xml_no
         }
         if (effectName == "animFrame")
         {
-            def->animFrame = boost::lexical_cast<int>(effectNode->value());
+            def->animFrame = XMLValue::Value<int>(effectNode);
             if (effectNode->first_attribute("followCrew"))
             {
                 def->followCrew = EventsParser::ParseBoolean(effectNode->first_attribute("followCrew")->value());
@@ -1029,15 +1119,15 @@ ActivatedPowerDefinition* CustomCrewManager::ParseAbilityEffect(rapidxml::xml_no
         }
         if (effectName == "crewHealth")
         {
-            def->crewHealth = boost::lexical_cast<float>(effectNode->value());
+            def->crewHealth = XMLValue::Value<float>(effectNode);
         }
         if (effectName == "enemyHealth")
         {
-            def->enemyHealth = boost::lexical_cast<float>(effectNode->value());
+            def->enemyHealth = XMLValue::Value<float>(effectNode);
         }
         if (effectName == "selfHealth")
         {
-            def->selfHealth = boost::lexical_cast<float>(effectNode->value());
+            def->selfHealth = XMLValue::Value<float>(effectNode);
         }
         if (effectName == "activateWhenReady")
         {
@@ -1096,7 +1186,7 @@ ActivatedPowerDefinition* CustomCrewManager::ParseAbilityEffect(rapidxml::xml_no
 
         if (effectName == "sortOrder")
         {
-            def->sortOrder = boost::lexical_cast<int>(effectNode->value());
+            def->sortOrder = XMLValue::Value<int>(effectNode);
         }
 
         if (effectName == "hideCooldown")
@@ -1127,7 +1217,7 @@ ActivatedPowerDefinition* CustomCrewManager::ParseAbilityEffect(rapidxml::xml_no
 
                 if (tempEffectName == "duration")
                 {
-                    def->tempPower.duration = boost::lexical_cast<float>(tempEffectNode->value());
+                    def->tempPower.duration = XMLValue::Value<float>(tempEffectNode);
                 }
                 if (tempEffectName == "cooldownColor")
                 {
@@ -1150,31 +1240,31 @@ ActivatedPowerDefinition* CustomCrewManager::ParseAbilityEffect(rapidxml::xml_no
                 }
                 if (tempEffectName == "stunMultiplier")
                 {
-                    def->tempPower.stunMultiplier = boost::lexical_cast<float>(tempEffectNode->value());
+                    def->tempPower.stunMultiplier = XMLValue::Value<float>(tempEffectNode);
                 }
                 if (tempEffectName == "moveSpeedMultiplier")
                 {
-                    def->tempPower.moveSpeedMultiplier = boost::lexical_cast<float>(tempEffectNode->value());
+                    def->tempPower.moveSpeedMultiplier = XMLValue::Value<float>(tempEffectNode);
                 }
                 if (tempEffectName == "repairSpeed")
                 {
-                    def->tempPower.repairSpeed = boost::lexical_cast<float>(tempEffectNode->value());
+                    def->tempPower.repairSpeed = XMLValue::Value<float>(tempEffectNode);
                 }
                 if (tempEffectName == "damageMultiplier")
                 {
-                    def->tempPower.damageMultiplier = boost::lexical_cast<float>(tempEffectNode->value());
+                    def->tempPower.damageMultiplier = XMLValue::Value<float>(tempEffectNode);
                 }
                 if (tempEffectName == "rangedDamageMultiplier")
                 {
-                    def->tempPower.rangedDamageMultiplier = boost::lexical_cast<float>(tempEffectNode->value());
+                    def->tempPower.rangedDamageMultiplier = XMLValue::Value<float>(tempEffectNode);
                 }
                 if (tempEffectName == "doorDamageMultiplier")
                 {
-                    def->tempPower.doorDamageMultiplier = boost::lexical_cast<float>(tempEffectNode->value());
+                    def->tempPower.doorDamageMultiplier = XMLValue::Value<float>(tempEffectNode);
                 }
                 if (tempEffectName == "bonusPower")
                 {
-                    def->tempPower.bonusPower = boost::lexical_cast<int>(tempEffectNode->value());
+                    def->tempPower.bonusPower = XMLValue::Value<int>(tempEffectNode);
                 }
                 if (tempEffectName == "animSheet")
                 {
@@ -1226,11 +1316,11 @@ ActivatedPowerDefinition* CustomCrewManager::ParseAbilityEffect(rapidxml::xml_no
                 }
                 if (tempEffectName == "suffocationModifier")
                 {
-                    def->tempPower.suffocationModifier = boost::lexical_cast<float>(tempEffectNode->value());
+                    def->tempPower.suffocationModifier = XMLValue::Value<float>(tempEffectNode);
                 }
                 if (tempEffectName == "oxygenChangeSpeed")
                 {
-                    def->tempPower.oxygenChangeSpeed = boost::lexical_cast<float>(tempEffectNode->value());
+                    def->tempPower.oxygenChangeSpeed = XMLValue::Value<float>(tempEffectNode);
                 }
                 if (tempEffectName == "canPhaseThroughDoors")
                 {
@@ -1250,47 +1340,47 @@ ActivatedPowerDefinition* CustomCrewManager::ParseAbilityEffect(rapidxml::xml_no
                 }
                 if (tempEffectName == "fireDamageMultiplier")
                 {
-                    def->tempPower.fireDamageMultiplier = boost::lexical_cast<float>(tempEffectNode->value());
+                    def->tempPower.fireDamageMultiplier = XMLValue::Value<float>(tempEffectNode);
                 }
                 if (tempEffectName == "damageTakenMultiplier")
                 {
-                    def->tempPower.damageTakenMultiplier = boost::lexical_cast<float>(tempEffectNode->value());
+                    def->tempPower.damageTakenMultiplier = XMLValue::Value<float>(tempEffectNode);
                 }
                 if (tempEffectName == "allDamageTakenMultiplier")
                 {
-                    def->tempPower.allDamageTakenMultiplier = boost::lexical_cast<float>(tempEffectNode->value());
+                    def->tempPower.allDamageTakenMultiplier = XMLValue::Value<float>(tempEffectNode);
                 }
                 if (tempEffectName == "sabotageSpeedMultiplier")
                 {
-                    def->tempPower.sabotageSpeedMultiplier = boost::lexical_cast<float>(tempEffectNode->value());
+                    def->tempPower.sabotageSpeedMultiplier = XMLValue::Value<float>(tempEffectNode);
                 }
                 if (tempEffectName == "passiveHealAmount")
                 {
-                    def->tempPower.passiveHealAmount = boost::lexical_cast<float>(tempEffectNode->value());
+                    def->tempPower.passiveHealAmount = XMLValue::Value<float>(tempEffectNode);
                 }
                 if (tempEffectName == "healAmount")
                 {
-                    def->tempPower.healAmount = boost::lexical_cast<float>(tempEffectNode->value());
+                    def->tempPower.healAmount = XMLValue::Value<float>(tempEffectNode);
                 }
                 if (tempEffectName == "truePassiveHealAmount")
                 {
-                    def->tempPower.truePassiveHealAmount = boost::lexical_cast<float>(tempEffectNode->value());
+                    def->tempPower.truePassiveHealAmount = XMLValue::Value<float>(tempEffectNode);
                 }
                 if (tempEffectName == "trueHealAmount")
                 {
-                    def->tempPower.trueHealAmount = boost::lexical_cast<float>(tempEffectNode->value());
+                    def->tempPower.trueHealAmount = XMLValue::Value<float>(tempEffectNode);
                 }
                 if (tempEffectName == "damageEnemiesAmount")
                 {
-                    def->tempPower.damageEnemiesAmount = boost::lexical_cast<float>(tempEffectNode->value());
+                    def->tempPower.damageEnemiesAmount = XMLValue::Value<float>(tempEffectNode);
                 }
                 if (tempEffectName == "animFrame")
                 {
-                    def->tempPower.animFrame = boost::lexical_cast<int>(tempEffectNode->value());
+                    def->tempPower.animFrame = XMLValue::Value<int>(tempEffectNode);
                 }
                 if (tempEffectName == "healCrewAmount")
                 {
-                    def->tempPower.healCrewAmount = boost::lexical_cast<float>(tempEffectNode->value());
+                    def->tempPower.healCrewAmount = XMLValue::Value<float>(tempEffectNode);
                 }
                 if (tempEffectName == "effectFinishAnim")
                 {
@@ -1298,7 +1388,7 @@ ActivatedPowerDefinition* CustomCrewManager::ParseAbilityEffect(rapidxml::xml_no
                 }
                 if (tempEffectName == "powerDrain")
                 {
-                    def->tempPower.powerDrain = boost::lexical_cast<int>(tempEffectNode->value());
+                    def->tempPower.powerDrain = XMLValue::Value<int>(tempEffectNode);
                 }
                 if (tempEffectName == "powerDrainFriendly")
                 {
@@ -1306,7 +1396,7 @@ ActivatedPowerDefinition* CustomCrewManager::ParseAbilityEffect(rapidxml::xml_no
                 }
                 if (tempEffectName == "powerRechargeMultiplier")
                 {
-                    def->tempPower.powerRechargeMultiplier = boost::lexical_cast<float>(tempEffectNode->value());
+                    def->tempPower.powerRechargeMultiplier = XMLValue::Value<float>(tempEffectNode);
                 }
                 if (tempEffectName == "statBoosts")
                 {
@@ -1321,7 +1411,7 @@ ActivatedPowerDefinition* CustomCrewManager::ParseAbilityEffect(rapidxml::xml_no
                 }
                 if (tempEffectName == "cloneSpeedMultiplier")
                 {
-                    def->tempPower.cloneSpeedMultiplier = boost::lexical_cast<float>(tempEffectNode->value());
+                    def->tempPower.cloneSpeedMultiplier = XMLValue::Value<float>(tempEffectNode);
                 }
                 if (tempEffectName == "noAI")
                 {
@@ -1349,7 +1439,7 @@ ActivatedPowerDefinition* CustomCrewManager::ParseAbilityEffect(rapidxml::xml_no
                 }
                 if (tempEffectName == "lowHealthThreshold")
                 {
-                    def->tempPower.lowHealthThreshold = boost::lexical_cast<float>(tempEffectNode->value());
+                    def->tempPower.lowHealthThreshold = XMLValue::Value<float>(tempEffectNode);
                 }
                 if (tempEffectName == "noWarning")
                 {
@@ -1453,7 +1543,7 @@ PowerResourceDefinition* CustomCrewManager::ParseAbilityResource(rapidxml::xml_n
         }
         if (effectName == "initialCooldownFraction")
         {
-            def->initialCooldownFraction = boost::lexical_cast<float>(effectNode->value());
+            def->initialCooldownFraction = XMLValue::Value<float>(effectNode);
         }
         if (effectName == "onDeath")
         {
@@ -1465,23 +1555,23 @@ PowerResourceDefinition* CustomCrewManager::ParseAbilityResource(rapidxml::xml_n
         }
         if (effectName == "cooldown")
         {
-            def->cooldown = boost::lexical_cast<float>(effectNode->value());
+            def->cooldown = XMLValue::Value<float>(effectNode);
         }
         if (effectName == "powerCharges")
         {
-            def->powerCharges = boost::lexical_cast<int>(effectNode->value());
+            def->powerCharges = XMLValue::Value<int>(effectNode);
         }
         if (effectName == "initialCharges")
         {
-            def->initialCharges = boost::lexical_cast<int>(effectNode->value());
+            def->initialCharges = XMLValue::Value<int>(effectNode);
         }
         if (effectName == "respawnCharges")
         {
-            def->respawnCharges = boost::lexical_cast<int>(effectNode->value());
+            def->respawnCharges = XMLValue::Value<int>(effectNode);
         }
         if (effectName == "chargesPerJump")
         {
-            def->chargesPerJump = boost::lexical_cast<int>(effectNode->value());
+            def->chargesPerJump = XMLValue::Value<int>(effectNode);
         }
         if (effectName == "cooldownColor")
         {
@@ -1490,7 +1580,7 @@ PowerResourceDefinition* CustomCrewManager::ParseAbilityResource(rapidxml::xml_n
 
         if (effectName == "sortOrder")
         {
-            def->sortOrder = boost::lexical_cast<int>(effectNode->value());
+            def->sortOrder = XMLValue::Value<int>(effectNode);
         }
 
         if (effectName == "hideCooldown")
@@ -1643,11 +1733,11 @@ void CustomCrewManager::ParsePowerRequirementsNode(rapidxml::xml_node<char> *nod
         }
         if (req == "minHealth")
         {
-            def->minHealth = boost::lexical_cast<int>(reqVal);
+            def->minHealth = XMLValue::Value<int>(reqNode);
         }
         if (req == "maxHealth")
         {
-            def->maxHealth = boost::lexical_cast<int>(reqVal);
+            def->maxHealth = XMLValue::Value<int>(reqNode);
         }
         if (req == "extraConditions")
         {
@@ -1673,6 +1763,8 @@ void CustomCrewManager::ParsePowerRequirementsNode(rapidxml::xml_node<char> *nod
             }
         }
     }
+
+    def->CompileSpeciesLists();
 }
 
 void CustomCrewManager::ParseExtraConditionsNode(rapidxml::xml_node<char> *node, std::vector<std::pair<CrewExtraCondition,bool>> &extraConditions)
@@ -1769,6 +1861,35 @@ bool CustomCrewManager::IsRace(const std::string& race)
     return blueprintNames.find(race) != blueprintNames.end();
 }
 
+int CustomCrewManager::GetSpeciesId(const std::string& species)
+{
+    return speciesIds.emplace(species, speciesIds.size()).first->second;
+}
+
+void SpeciesSet::Compile(const std::vector<std::string>& newNames)
+{
+    names = newNames;
+    bits.clear();
+    for (const std::string& name : names)
+    {
+        int id = CustomCrewManager::GetSpeciesId(name);
+        std::size_t word = id >> 6;
+        if (word >= bits.size()) bits.resize(word + 1, 0);
+        bits[word] |= uint64_t(1) << (id & 63);
+    }
+}
+
+int CrewMember_Extend::GetSpeciesId()
+{
+    // species is writable from lua, so re-resolve the id whenever it changes
+    if (speciesId == -1 || speciesIdName != orig->species)
+    {
+        speciesIdName = orig->species;
+        speciesId = CustomCrewManager::GetSpeciesId(speciesIdName);
+    }
+    return speciesId;
+}
+
 std::string CrewMember_Extend::GetRace()
 {
     // Get effective race, including special race for ion intruder
@@ -3064,8 +3185,7 @@ HOOK_METHOD(CrewMember, LoadState, (int file) -> void)
     super(file);
 
     health = customHealth;
-    ex->statCache[(unsigned int)CrewStat::MAX_HEALTH].first = health.second;
-    ex->statCache[(unsigned int)CrewStat::MAX_HEALTH].second = StatBoostManager::statCacheFrame;
+    ex->SetCachedStat((unsigned int)CrewStat::MAX_HEALTH, health.second);
 }
 
 HOOK_METHOD_PRIORITY(CrewMember, GetNewGoal, 2000, () -> bool)
@@ -3292,14 +3412,14 @@ HOOK_METHOD_PRIORITY(CrewMember, GetNewGoal, 2000, () -> bool)
 HOOK_METHOD(BlueprintManager, GetCrewBlueprint, (const std::string &name) -> CrewBlueprint)
 {
     LOG_HOOK("HOOK_METHOD -> BlueprintManager::GetCrewBlueprint -> Begin (CustomCrew.cpp)\n")
-    std::vector<std::string> blueprintList = this->GetBlueprintList(name);
-    if (blueprintList.empty())
+    const std::string *picked = BlueprintListRegistry::Pick(name);
+    if (!picked)
     {
         return super(name);
     }
     else
     {
-        return super(blueprintList[random32()%blueprintList.size()]);
+        return super(*picked);
     }
 }
 
@@ -3307,12 +3427,12 @@ HOOK_METHOD(ShipManager, AddCrewMemberFromString, (const std::string& name, cons
 {
     LOG_HOOK("HOOK_METHOD -> ShipManager::AddCrewMemberFromString -> Begin (CustomCrew.cpp)\n")
     std::string actualRace = race;
-    std::vector<std::string> blueprintList = G_->GetBlueprints()->GetBlueprintList(actualRace);
+    const std::string *picked = BlueprintListRegistry::Pick(actualRace);
 
-    while (!blueprintList.empty())
+    while (picked)
     {
-        actualRace = blueprintList[random32()%blueprintList.size()];
-        blueprintList = G_->GetBlueprints()->GetBlueprintList(actualRace);
+        actualRace = *picked;
+        picked = BlueprintListRegistry::Pick(actualRace);
     }
 
     return super(name, actualRace, intruder, roomId, init, male);
@@ -3321,14 +3441,14 @@ HOOK_METHOD(ShipManager, AddCrewMemberFromString, (const std::string& name, cons
 HOOK_METHOD(CompleteShip, AddCrewMember1, (const std::string &race, const std::string &name, bool hostile) -> CrewMember*)
 {
     LOG_HOOK("HOOK_METHOD -> CompleteShip::AddCrewMember1 -> Begin (CustomCrew.cpp)\n")
-    std::vector<std::string> blueprintList = G_->GetBlueprints()->GetBlueprintList(race);
-    if (blueprintList.empty())
+    const std::string *picked = BlueprintListRegistry::Pick(race);
+    if (!picked)
     {
         return super(race, name, hostile);
     }
     else
     {
-        return AddCrewMember1(blueprintList[random32()%blueprintList.size()], name, hostile);
+        return AddCrewMember1(*picked, name, hostile);
     }
 }
 
@@ -5268,7 +5388,7 @@ HOOK_METHOD_PRIORITY(CrewMember, Clone, -9999, () -> void)
     // lua callback
     auto context = Global::GetInstance()->getLuaContext();
 
-    SWIG_NewPointerObj(context->GetLua(), this, context->getLibScript()->types.pCrewMember, 0);
+    LuaLibScript::push_cached_pointer(context->GetLua(), this, context->getLibScript()->types.pCrewMember);
     context->getLibScript()->call_on_internal_event_callbacks(InternalEvents::CREW_CLONE, 1);
     lua_pop(context->GetLua(), 1);
 
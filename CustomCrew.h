@@ -189,6 +189,28 @@ struct TemporaryPowerDefinition
     GL_Color cooldownColor;
 };
 
+// Species names compiled to bits indexed by CustomCrewManager::GetSpeciesId
+struct SpeciesSet
+{
+    std::vector<uint64_t> bits;
+    std::vector<std::string> names; // the list the bits were compiled from
+
+    void Compile(const std::vector<std::string>& newNames);
+
+    // Recompiles if the list changed since the last compile.
+    // Lists are short, so comparing them is far cheaper than searching them for every crew member.
+    void Update(const std::vector<std::string>& newNames)
+    {
+        if (newNames != names) Compile(newNames);
+    }
+
+    bool Contains(int speciesId) const
+    {
+        std::size_t word = speciesId >> 6;
+        return word < bits.size() && ((bits[word] >> (speciesId & 63)) & 1);
+    }
+};
+
 struct ActivatedPowerRequirements
 {
     enum class Type : unsigned int
@@ -234,6 +256,23 @@ struct ActivatedPowerRequirements
     std::vector<std::pair<CrewExtraCondition,bool>> extraConditions = std::vector<std::pair<CrewExtraCondition,bool>>();
     std::vector<std::pair<CrewExtraCondition,bool>> extraOrConditions = std::vector<std::pair<CrewExtraCondition,bool>>();
     TextString extraOrConditionsTooltip;
+
+    // Bitset versions of the species lists. The lists stay writable from lua (assignment, push_back, ...),
+    // so the sets are checked against them before use.
+    mutable SpeciesSet whiteListSet;
+    mutable SpeciesSet friendlyWhiteListSet;
+    mutable SpeciesSet friendlyBlackListSet;
+    mutable SpeciesSet enemyWhiteListSet;
+    mutable SpeciesSet enemyBlackListSet;
+
+    void CompileSpeciesLists() const
+    {
+        whiteListSet.Update(whiteList);
+        friendlyWhiteListSet.Update(friendlyWhiteList);
+        friendlyBlackListSet.Update(friendlyBlackList);
+        enemyWhiteListSet.Update(enemyWhiteList);
+        enemyBlackListSet.Update(enemyBlackList);
+    }
 };
 
 struct PowerResourceDefinition;
@@ -759,6 +798,8 @@ public:
 
     CrewDefinition* GetDroneRaceDefinition(CrewDrone *drone);
 
+    static int GetSpeciesId(const std::string& species);
+
     std::vector<std::string> GetBlueprintNames()
     {
         std::vector<std::string> ret = std::vector<std::string>();
@@ -782,4 +823,5 @@ private:
     static CustomCrewManager instance;
 
     std::unordered_map<std::string, CrewDefinition> blueprintNames;
+    static std::unordered_map<std::string, int> speciesIds;
 };
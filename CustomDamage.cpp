@@ -18,7 +18,7 @@ HOOK_METHOD(ShipManager, DamageArea, (Pointf location, Damage dmg, bool forceHit
 
     // push everything to the lua stack: ShipManager, Projectile, location, Damage, forceHit, shipFriendlyFire
     auto context = Global::GetInstance()->getLuaContext();
-    SWIG_NewPointerObj(context->GetLua(), this, context->getLibScript()->types.pShipManager, 0);
+    LuaLibScript::push_cached_pointer(context->GetLua(), this, context->getLibScript()->types.pShipManager);
     CustomDamageManager::lua_PushCurrentProjectile(context);
     SWIG_NewPointerObj(context->GetLua(), &location, context->getLibScript()->types.pPointf, 0);
     SWIG_NewPointerObj(context->GetLua(), &dmg, context->getLibScript()->types.pDamage, 0);
@@ -54,6 +54,8 @@ HOOK_METHOD(ShipManager, DamageArea, (Pointf location, Damage dmg, bool forceHit
         lua_pop(context->GetLua(), 6);
 
         // reproduce the miss code here
+        // damMessages is owned by the game, which deletes each message with operator delete once it
+        // expires, so entries have to be plain heap allocations and can't come from a recycled pool
         if (!bJumping)
         {
             damMessages.push_back(new DamageMessage(1.f, location, DamageMessage::MISS));
@@ -158,7 +160,7 @@ HOOK_METHOD(ShipManager, DamageBeam, (Pointf location1, Pointf location2, Damage
 
     // push everything to the lua stack: ShipManager, Projectile, location, Damage, realNewTile, beamHitType
     auto context = Global::GetInstance()->getLuaContext();
-    SWIG_NewPointerObj(context->GetLua(), this, context->getLibScript()->types.pShipManager, 0);
+    LuaLibScript::push_cached_pointer(context->GetLua(), this, context->getLibScript()->types.pShipManager);
     CustomDamageManager::lua_PushCurrentProjectile(context);
     SWIG_NewPointerObj(context->GetLua(), &location1, context->getLibScript()->types.pPointf, 0);
     SWIG_NewPointerObj(context->GetLua(), &dmg, context->getLibScript()->types.pDamage, 0);
@@ -296,7 +298,7 @@ HOOK_METHOD_PRIORITY(ShipManager, DamageSystem, -100, (int roomId, Damage dmg) -
 
     // push everything to the lua stack: ShipManager, Projectile, room ID, Damage
     auto context = Global::GetInstance()->getLuaContext();
-    SWIG_NewPointerObj(context->GetLua(), this, context->getLibScript()->types.pShipManager, 0);
+    LuaLibScript::push_cached_pointer(context->GetLua(), this, context->getLibScript()->types.pShipManager);
     CustomDamageManager::lua_PushCurrentProjectile(context);
     lua_pushinteger(context->GetLua(), roomId);
     SWIG_NewPointerObj(context->GetLua(), &dmg, context->getLibScript()->types.pDamage, 0);
@@ -326,7 +328,7 @@ HOOK_METHOD_PRIORITY(ShipSystem, AddDamage, -100, (int amount) -> void)
 
     // push everything to the lua stack: ShipSystem, Projectile, amount
     auto context = Global::GetInstance()->getLuaContext();
-    SWIG_NewPointerObj(context->GetLua(), this, context->getLibScript()->GetShipSystemType(iSystemType), 0);
+    LuaLibScript::push_cached_pointer(context->GetLua(), this, context->getLibScript()->GetShipSystemType(iSystemType));
     CustomDamageManager::lua_PushCurrentProjectile(context);
     lua_pushinteger(context->GetLua(), amount);
 
@@ -520,7 +522,7 @@ HOOK_METHOD(Projectile, Initialize, (WeaponBlueprint& bp) -> void)
 
     // Callback with Projectile and WeaponBlueprint
     auto context = Global::GetInstance()->getLuaContext();
-    SWIG_NewPointerObj(context->GetLua(), this, context->getLibScript()->types.pProjectile[this->GetType()], 0);
+    LuaLibScript::push_cached_pointer(context->GetLua(), this, context->getLibScript()->types.pProjectile[this->GetType()]);
     SWIG_NewPointerObj(context->GetLua(), &bp, context->getLibScript()->types.pWeaponBlueprint, 0);
     context->getLibScript()->call_on_internal_chain_event_callbacks(InternalEvents::PROJECTILE_INITIALIZE, 2, 0);
     lua_pop(context->GetLua(), 2);
@@ -540,7 +542,7 @@ HOOK_METHOD(SpaceManager, UpdateProjectile, (Projectile *projectile) -> void)
 
     // push projectile onto lua stack
     auto context = Global::GetInstance()->getLuaContext();
-    SWIG_NewPointerObj(context->GetLua(), projectile, context->getLibScript()->types.pProjectile[projectile->GetType()], 0);
+    LuaLibScript::push_cached_pointer(context->GetLua(), projectile, context->getLibScript()->types.pProjectile[projectile->GetType()]);
 
     bool preempt = context->getLibScript()->call_on_internal_chain_event_callbacks(InternalEvents::PROJECTILE_PRE, 1, 0);
 
@@ -575,7 +577,7 @@ void Projectile::HS_OnUpdate()
 
     // push projectile onto lua stack
     auto context = Global::GetInstance()->getLuaContext();
-    SWIG_NewPointerObj(context->GetLua(), this, context->getLibScript()->types.pProjectile[this->GetType()], 0);
+    LuaLibScript::push_cached_pointer(context->GetLua(), this, context->getLibScript()->types.pProjectile[this->GetType()]);
 
     // call the real OnUpdate (will call the virtual method)
     this->OnUpdate();
@@ -781,7 +783,7 @@ HOOK_METHOD_PRIORITY(SpaceDrone, CollisionMoving, 9999, (Pointf start, Pointf fi
     {
         // push everything to the lua stack: Drone, Projectile, Damage, CollisionResponse
         auto context = Global::GetInstance()->getLuaContext();
-        SWIG_NewPointerObj(context->GetLua(), this, context->getLibScript()->types.pSpaceDroneTypes[this->type], 0);
+        LuaLibScript::push_cached_pointer(context->GetLua(), this, context->getLibScript()->types.pSpaceDroneTypes[this->type]);
         CustomDamageManager::lua_PushCurrentProjectile(context);
         SWIG_NewPointerObj(context->GetLua(), &damage, context->getLibScript()->types.pDamage, 0);
         SWIG_NewPointerObj(context->GetLua(), &ret, context->getLibScript()->types.pCollisionResponse, 0);
@@ -861,7 +863,7 @@ HOOK_METHOD(Projectile, CollisionMoving, (Pointf start, Pointf finish, Damage da
     {
         // push everything to the lua stack: this Projectile, Projectile, Damage, CollisionResponse
         auto context = Global::GetInstance()->getLuaContext();
-        SWIG_NewPointerObj(context->GetLua(), this, context->getLibScript()->types.pProjectile[this->GetType()], 0);
+        LuaLibScript::push_cached_pointer(context->GetLua(), this, context->getLibScript()->types.pProjectile[this->GetType()]);
         CustomDamageManager::lua_PushCurrentProjectile(context);
         SWIG_NewPointerObj(context->GetLua(), &damage, context->getLibScript()->types.pDamage, 0);
         SWIG_NewPointerObj(context->GetLua(), &ret, context->getLibScript()->types.pCollisionResponse, 0);
@@ -895,7 +897,7 @@ HOOK_METHOD_PRIORITY(ShipManager, CollisionShield, 9999, (Pointf start, Pointf f
         {
             // push everything to the lua stack: ShipManager, Projectile, Damage, CollisionResponse
             auto context = Global::GetInstance()->getLuaContext();
-            SWIG_NewPointerObj(context->GetLua(), this, context->getLibScript()->types.pShipManager, 0);
+            LuaLibScript::push_cached_pointer(context->GetLua(), this, context->getLibScript()->types.pShipManager);
             CustomDamageManager::lua_PushCurrentProjectile(context);
             SWIG_NewPointerObj(context->GetLua(), &damage, context->getLibScript()->types.pDamage, 0);
             SWIG_NewPointerObj(context->GetLua(), &ret, context->getLibScript()->types.pCollisionResponse, 0);
@@ -102,7 +102,7 @@ public:
         // Lua library: pushes the current projectile (or nil if there is none) with the correct type
         if (currentProjectile)
         {
-            SWIG_NewPointerObj(context->GetLua(), currentProjectile, context->getLibScript()->types.pProjectile[currentProjectile->GetType()], 0);
+            LuaLibScript::push_cached_pointer(context->GetLua(), currentProjectile, context->getLibScript()->types.pProjectile[currentProjectile->GetType()]);
         }
         else
         {
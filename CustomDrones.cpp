@@ -70,6 +70,7 @@ void CustomDroneManager::ParseDroneNode(rapidxml::xml_node<char> *node)
                 }
 
                 droneDefs.push_back(def);
+                droneDefsByName.emplace(def->name, def);
             }
         }
     }
@@ -1224,7 +1225,7 @@ HOOK_METHOD(SpaceDrone, constructor, (int iShipId, int selfId, DroneBlueprint *b
     
     //Push base class data only, to avoid garbage data (Derived class constructor not yet called)
     auto context = G_->getLuaContext();
-    SWIG_NewPointerObj(context->GetLua(), this, context->getLibScript()->types.pSpaceDrone, 0);
+    LuaLibScript::push_cached_pointer(context->GetLua(), this, context->getLibScript()->types.pSpaceDrone);
     context->getLibScript()->call_on_internal_event_callbacks(InternalEvents::CONSTRUCT_SPACEDRONE, 1);
     lua_pop(context->GetLua(), 1);
 }
@@ -30,12 +30,10 @@ public:
 
     CustomDroneDefinition* GetDefinition(const std::string& droneName)
     {
-        for (auto i : droneDefs)
+        auto it = droneDefsByName.find(droneName);
+        if (it != droneDefsByName.end())
         {
-            if (i->name == droneName)
-            {
-                return i;
-            }
+            return it->second;
         }
 
         return nullptr;
@@ -62,6 +60,7 @@ public:
 private:
 
     std::vector<CustomDroneDefinition*> droneDefs = std::vector<CustomDroneDefinition*>();
+    std::unordered_map<std::string, CustomDroneDefinition*> droneDefsByName; // first definition parsed for each name
 
     static CustomDroneManager _instance;
 };
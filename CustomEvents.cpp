@@ -11,9 +11,13 @@
 #include "CustomAchievements.h"
 #include "CustomScoreKeeper.h"
 #include "CustomBackgroundObject.h"
+#include "CustomLocalization.h"
 #include "EventButtons.h"
-#include <boost/lexical_cast.hpp>
+#include "Profiler.h"
+#include "XMLTag.h"
+#include "XMLValue.h"
 #include <boost/algorithm/string.hpp>
+#include <sstream>
 
 std::bitset<8> advancedCheckEquipment{0x00};
 
@@ -520,9 +524,15 @@ void CustomEventsParser::ReadCustomEventFiles()
 
 void CustomEventsParser::ParseCustomEventNode(rapidxml::xml_node<char> *node)
 {
+    HS_PROFILE_SCOPE("CustomEventsParser::ParseCustomEventNode");
+
     for (auto eventNode = node->first_node(); eventNode; eventNode = eventNode->next_sibling())
     {
-        if (strcmp(eventNode->name(), "bossShip") == 0)
+        std::string nodeName = eventNode->name();
+
+        switch (XMLTag::Hash(nodeName))
+        {
+        HS_XML_TAG(nodeName, "bossShip")
         {
             if (eventNode->value())
             {
@@ -531,19 +541,19 @@ void CustomEventsParser::ParseCustomEventNode(rapidxml::xml_node<char> *node)
 
                 if (eventNode->first_attribute("yOffset"))
                 {
-                    def.yOffset = boost::lexical_cast<int>(eventNode->first_attribute("yOffset")->value());
+                    def.yOffset = XMLValue::Attribute<int>(eventNode, "yOffset");
                 }
 
                 bossShipIds[def.shipId] = def;
             }
         }
-
-        if (strcmp(eventNode->name(), "fleetDef") == 0)
+        break;
+        HS_XML_TAG(nodeName, "fleetDef")
         {
             ParseFleetShipNode(eventNode);
         }
-
-        if (strcmp(eventNode->name(), "sector") == 0)
+        break;
+        HS_XML_TAG(nodeName, "sector")
         {
             std::string sectorName = eventNode->first_attribute("name")->value();
 
@@ -563,8 +573,8 @@ void CustomEventsParser::ParseCustomEventNode(rapidxml::xml_node<char> *node)
                 customSectorsPreload[sectorName] = sec;
             }
         }
-
-        if (strcmp(eventNode->name(), "revisitEvent") == 0)
+        break;
+        HS_XML_TAG(nodeName, "revisitEvent")
         {
             defaultRevisit = eventNode->value();
 
@@ -577,8 +587,8 @@ void CustomEventsParser::ParseCustomEventNode(rapidxml::xml_node<char> *node)
                 defaultRevisitIgnoreUnique = EventsParser::ParseBoolean(eventNode->first_attribute("ignoreUnique")->value());
             }
         }
-
-        if (strcmp(eventNode->name(), "event") == 0)
+        break;
+        HS_XML_TAG(nodeName, "event")
         {
             if (eventNode->first_attribute("name"))
             {
@@ -648,8 +658,8 @@ void CustomEventsParser::ParseCustomEventNode(rapidxml::xml_node<char> *node)
                 }
             }
         }
-
-        if (strcmp(eventNode->name(), "shipEvent") == 0)
+        break;
+        HS_XML_TAG(nodeName, "shipEvent")
         {
             if (eventNode->first_attribute("name"))
             {
@@ -671,13 +681,13 @@ void CustomEventsParser::ParseCustomEventNode(rapidxml::xml_node<char> *node)
                 }
             }
         }
-
-        if (strcmp(eventNode->name(), "quest") == 0)
+        break;
+        HS_XML_TAG(nodeName, "quest")
         {
             ParseCustomQuestNode(eventNode, defaultQuest);
         }
-
-        if (strcmp(eventNode->name(), "req") == 0)
+        break;
+        HS_XML_TAG(nodeName, "req")
         {
             if (eventNode->first_attribute("name"))
             {
@@ -704,8 +714,8 @@ void CustomEventsParser::ParseCustomEventNode(rapidxml::xml_node<char> *node)
                 ErrorMessage("Custom req is missing a name!\n");
             }
         }
-
-        if (strcmp(eventNode->name(), "combatTimerPosition") == 0)
+        break;
+        HS_XML_TAG(nodeName, "combatTimerPosition")
         {
             for (auto child = eventNode->first_node(); child; child = child->next_sibling())
             {
@@ -714,40 +724,53 @@ void CustomEventsParser::ParseCustomEventNode(rapidxml::xml_node<char> *node)
                 {
                     if (child->first_attribute("x"))
                     {
-                        TriggeredEventGui::GetInstance()->normalBoxPos.x = boost::lexical_cast<int>(child->first_attribute("x")->value());
+                        TriggeredEventGui::GetInstance()->normalBoxPos.x = XMLValue::Attribute<int>(child, "x");
                     }
                     if (child->first_attribute("y"))
                     {
-                        TriggeredEventGui::GetInstance()->normalBoxPos.y = boost::lexical_cast<int>(child->first_attribute("y")->value());
+                        TriggeredEventGui::GetInstance()->normalBoxPos.y = XMLValue::Attribute<int>(child, "y");
                     }
                 }
                 if (nodeName == "bossPos")
                 {
                     if (child->first_attribute("x"))
                     {
-                        TriggeredEventGui::GetInstance()->bossBoxPos.x = boost::lexical_cast<int>(child->first_attribute("x")->value());
+                        TriggeredEventGui::GetInstance()->bossBoxPos.x = XMLValue::Attribute<int>(child, "x");
                     }
                     if (child->first_attribute("y"))
                     {
-                        TriggeredEventGui::GetInstance()->bossBoxPos.y = boost::lexical_cast<int>(child->first_attribute("y")->value());
+                        TriggeredEventGui::GetInstance()->bossBoxPos.y = XMLValue::Attribute<int>(child, "y");
                     }
                 }
             }
         }
-
-        if (strcmp(eventNode->name(), "variable") == 0)
+        break;
+        HS_XML_TAG(nodeName, "variable")
         {
             VariableModifier variable;
             variable.ParseVariableModifierNode(eventNode);
             initialPlayerVars.push_back(variable);
         }
-
-        if (strcmp(eventNode->name(), "metaVariable") == 0)
+        break;
+        HS_XML_TAG(nodeName, "metaVariable")
         {
             VariableModifier variable;
             variable.ParseVariableModifierNode(eventNode);
             initialMetaVars.push_back(variable);
         }
+        break;
+        // parsed by EarlyParseCustomEventNode
+        HS_XML_TAG(nodeName, "eventFile") break;
+        HS_XML_TAG(nodeName, "loadEventList") break;
+        HS_XML_TAG(nodeName, "triggeredEventBox") break;
+        HS_XML_TAG(nodeName, "timerSounds") break;
+        HS_XML_TAG(nodeName, "warningMessage") break;
+        HS_XML_TAG(nodeName, "beaconType") break;
+        HS_XML_TAG(nodeName, "backgroundObject") break;
+        HS_XML_TAG(nodeName, "eventButton") break;
+        default:
+            XMLTag::Unknown("events", nodeName);
+        }
     }
 }
 
@@ -860,7 +883,7 @@ void CustomEventsParser::ParseCustomSector(rapidxml::xml_node<char> *node, Custo
     if (node->first_attribute("maxSector"))
     {
         isDefault = false;
-        sector->maxSector = boost::lexical_cast<int>(node->first_attribute("maxSector")->value());
+        sector->maxSector = XMLValue::Attribute<int>(node, "maxSector");
     }
 
     for (auto sectorNode = node->first_node(); sectorNode; sectorNode = sectorNode->next_sibling())
@@ -926,7 +949,7 @@ void CustomEventsParser::ParseCustomSector(rapidxml::xml_node<char> *node, Custo
         if (strcmp(sectorNode->name(), "maxSector") == 0)
         {
             isDefault = false;
-            sector->maxSector = boost::lexical_cast<int>(sectorNode->value());
+            sector->maxSector = XMLValue::Value<int>(sectorNode);
         }
         if (strcmp(sectorNode->name(), "priorityEvent") == 0)
         {
@@ -945,15 +968,15 @@ void CustomEventsParser::ParseCustomSector(rapidxml::xml_node<char> *node, Custo
             }
             if (sectorNode->first_attribute("min"))
             {
-                event.event.second.min = boost::lexical_cast<int>(sectorNode->first_attribute("min")->value());
+                event.event.second.min = XMLValue::Attribute<int>(sectorNode, "min");
             }
             if (sectorNode->first_attribute("max"))
             {
-                event.event.second.max = boost::lexical_cast<int>(sectorNode->first_attribute("max")->value());
+                event.event.second.max = XMLValue::Attribute<int>(sectorNode, "max");
             }
             if (sectorNode->first_attribute("priority"))
             {
-                event.priority = boost::lexical_cast<int>(sectorNode->first_attribute("priority")->value());
+                event.priority = XMLValue::Attribute<int>(sectorNode, "priority");
             }
             else
             {
@@ -965,12 +988,12 @@ void CustomEventsParser::ParseCustomSector(rapidxml::xml_node<char> *node, Custo
             }
             if (sectorNode->first_attribute("max_lvl"))
             {
-                event.max_lvl = boost::lexical_cast<int>(sectorNode->first_attribute("max_lvl")->value());
+                event.max_lvl = XMLValue::Attribute<int>(sectorNode, "max_lvl");
                 event.lvl = -2147483648;
             }
             if (sectorNode->first_attribute("lvl"))
             {
-                event.lvl = boost::lexical_cast<int>(sectorNode->first_attribute("lvl")->value());
+                event.lvl = XMLValue::Attribute<int>(sectorNode, "lvl");
             }
         }
         if (strcmp(sectorNode->name(), "quest") == 0)
@@ -1001,12 +1024,12 @@ void CustomEventsParser::ParseCustomSector(rapidxml::xml_node<char> *node, Custo
             }
             if (sectorNode->first_attribute("max_lvl"))
             {
-                event.max_lvl = boost::lexical_cast<int>(sectorNode->first_attribute("max_lvl")->value());
+                event.max_lvl = XMLValue::Attribute<int>(sectorNode, "max_lvl");
                 event.lvl = -2147483648;
             }
             if (sectorNode->first_attribute("lvl"))
             {
-                event.lvl = boost::lexical_cast<int>(sectorNode->first_attribute("lvl")->value());
+                event.lvl = XMLValue::Attribute<int>(sectorNode, "lvl");
             }
         }
     }
@@ -1113,29 +1136,29 @@ bool CustomEventsParser::ParseCustomEvent(rapidxml::xml_node<char> *node, Custom
                 }
                 if (child->first_attribute("time"))
                 {
-                    def.minTime = boost::lexical_cast<float>(child->first_attribute("time")->value());
-                    def.maxTime = boost::lexical_cast<float>(child->first_attribute("time")->value());
+                    def.minTime = XMLValue::Attribute<float>(child, "time");
+                    def.maxTime = XMLValue::Attribute<float>(child, "time");
                 }
                 if (child->first_attribute("minTime"))
                 {
-                    def.minTime = boost::lexical_cast<float>(child->first_attribute("minTime")->value());
+                    def.minTime = XMLValue::Attribute<float>(child, "minTime");
                 }
                 if (child->first_attribute("maxTime"))
                 {
-                    def.maxTime = boost::lexical_cast<float>(child->first_attribute("maxTime")->value());
+                    def.maxTime = XMLValue::Attribute<float>(child, "maxTime");
                 }
                 if (child->first_attribute("jumps"))
                 {
-                    def.minJumps = boost::lexical_cast<int>(child->first_attribute("jumps")->value());
-                    def.maxJumps = boost::lexical_cast<int>(child->first_attribute("jumps")->value());
+                    def.minJumps = XMLValue::Attribute<int>(child, "jumps");
+                    def.maxJumps = XMLValue::Attribute<int>(child, "jumps");
                 }
                 if (child->first_attribute("minJumps"))
                 {
-                    def.minJumps = boost::lexical_cast<int>(child->first_attribute("minJumps")->value());
+                    def.minJumps = XMLValue::Attribute<int>(child, "minJumps");
                 }
                 if (child->first_attribute("maxJumps"))
                 {
-                    def.maxJumps = boost::lexical_cast<int>(child->first_attribute("maxJumps")->value());
+                    def.maxJumps = XMLValue::Attribute<int>(child, "maxJumps");
                 }
                 customEvent->triggeredEventModifiers.push_back(def);
             }
@@ -1302,7 +1325,7 @@ bool CustomEventsParser::ParseCustomEvent(rapidxml::xml_node<char> *node, Custom
             }
             if (child->first_attribute("priority"))
             {
-                jumpEvent.priority = boost::lexical_cast<int>(child->first_attribute("priority")->value());
+                jumpEvent.priority = XMLValue::Attribute<int>(child, "priority");
             }
 
             customEvent->jumpEvents.push_back(jumpEvent);
@@ -1345,7 +1368,7 @@ bool CustomEventsParser::ParseCustomEvent(rapidxml::xml_node<char> *node, Custom
             }
             if (child->first_attribute("priority"))
             {
-                deathEvent.priority = boost::lexical_cast<int>(child->first_attribute("priority")->value());
+                deathEvent.priority = XMLValue::Attribute<int>(child, "priority");
             }
 
             customEvent->deathEvents.push_back(deathEvent);
@@ -1500,11 +1523,11 @@ bool CustomEventsParser::ParseCustomEvent(rapidxml::xml_node<char> *node, Custom
             customEvent->ignoreEssential.second = 0.f;
             if (child->first_attribute("min"))
             {
-                customEvent->ignoreEssential.first = boost::lexical_cast<float>(child->first_attribute("min")->value());
+                customEvent->ignoreEssential.first = XMLValue::Attribute<float>(child, "min");
             }
             if (child->first_attribute("max"))
             {
-                customEvent->ignoreEssential.second = boost::lexical_cast<float>(child->first_attribute("max")->value());
+                customEvent->ignoreEssential.second = XMLValue::Attribute<float>(child, "max");
             }
         }
 
@@ -1785,7 +1808,7 @@ bool CustomEventsParser::ParseCustomEvent(rapidxml::xml_node<char> *node, Custom
             EventDamage eventDamage{-1,0,0};
             if (child->first_attribute("amount"))
             {
-                eventDamage.amount = boost::lexical_cast<int>(child->first_attribute("amount")->value());
+                eventDamage.amount = XMLValue::Attribute<int>(child, "amount");
             }
             if (child->first_attribute("system"))
             {
@@ -1888,11 +1911,11 @@ bool CustomEventsParser::ParseCustomEvent(rapidxml::xml_node<char> *node, Custom
             }
             if (child->first_attribute("amount"))
             {
-                customEvent->powerSuperShieldsSet = boost::lexical_cast<int>(child->first_attribute("amount")->value());
+                customEvent->powerSuperShieldsSet = XMLValue::Attribute<int>(child, "amount");
             }
             if (child->first_attribute("add"))
             {
-                customEvent->powerSuperShieldsAdd = boost::lexical_cast<int>(child->first_attribute("add")->value());
+                customEvent->powerSuperShieldsAdd = XMLValue::Attribute<int>(child, "add");
             }
         }
         if (nodeName == "noASBPlanet")
@@ -1940,29 +1963,29 @@ bool CustomEventsParser::ParseCustomShipEvent(rapidxml::xml_node<char> *node, Cu
             }
             if (child->first_attribute("time"))
             {
-                def.minTime = boost::lexical_cast<float>(child->first_attribute("time")->value());
-                def.maxTime = boost::lexical_cast<float>(child->first_attribute("time")->value());
+                def.minTime = XMLValue::Attribute<float>(child, "time");
+                def.maxTime = XMLValue::Attribute<float>(child, "time");
             }
             if (child->first_attribute("minTime"))
             {
-                def.minTime = boost::lexical_cast<float>(child->first_attribute("minTime")->value());
+                def.minTime = XMLValue::Attribute<float>(child, "minTime");
             }
             if (child->first_attribute("maxTime"))
             {
-                def.maxTime = boost::lexical_cast<float>(child->first_attribute("maxTime")->value());
+                def.maxTime = XMLValue::Attribute<float>(child, "maxTime");
             }
             if (child->first_attribute("jumps"))
             {
-                def.minJumps = boost::lexical_cast<int>(child->first_attribute("jumps")->value());
-                def.maxJumps = boost::lexical_cast<int>(child->first_attribute("jumps")->value());
+                def.minJumps = XMLValue::Attribute<int>(child, "jumps");
+                def.maxJumps = XMLValue::Attribute<int>(child, "jumps");
             }
             if (child->first_attribute("minJumps"))
             {
-                def.minJumps = boost::lexical_cast<int>(child->first_attribute("minJumps")->value());
+                def.minJumps = XMLValue::Attribute<int>(child, "minJumps");
             }
             if (child->first_attribute("maxJumps"))
             {
-                def.maxJumps = boost::lexical_cast<int>(child->first_attribute("maxJumps")->value());
+                def.maxJumps = XMLValue::Attribute<int>(child, "maxJumps");
             }
             customEvent->triggeredEventModifiers.push_back(def);
         }
@@ -1985,7 +2008,7 @@ bool CustomEventsParser::ParseCustomShipEvent(rapidxml::xml_node<char> *node, Cu
             }
             if (child->first_attribute("priority"))
             {
-                jumpEvent.priority = boost::lexical_cast<int>(child->first_attribute("priority")->value());
+                jumpEvent.priority = XMLValue::Attribute<int>(child, "priority");
             }
 
             customEvent->jumpEvents.push_back(jumpEvent);
@@ -2028,7 +2051,7 @@ bool CustomEventsParser::ParseCustomShipEvent(rapidxml::xml_node<char> *node, Cu
             }
             if (child->first_attribute("priority"))
             {
-                deathEvent.priority = boost::lexical_cast<int>(child->first_attribute("priority")->value());
+                deathEvent.priority = XMLValue::Attribute<int>(child, "priority");
             }
 
             customEvent->deathEvents.push_back(deathEvent);
@@ -2096,7 +2119,7 @@ bool CustomEventsParser::ParseCustomShipEvent(rapidxml::xml_node<char> *node, Cu
             }
             if (child->first_attribute("musicDelay"))
             {
-                customEvent->bossMusicDelay = boost::lexical_cast<int>(child->first_attribute("musicDelay")->value());
+                customEvent->bossMusicDelay = XMLValue::Attribute<int>(child, "musicDelay");
             }
         }
     }
@@ -2150,7 +2173,7 @@ bool CustomEventsParser::ParseCustomQuestNode(rapidxml::xml_node<char> *node, Cu
         if (nodeName == "aggressive")
         {
             isDefault = false;
-            quest->aggressive = boost::lexical_cast<int>(child->value());
+            quest->aggressive = XMLValue::Value<int>(child);
         }
 
         if (nodeName == "sectorEight")
@@ -2286,19 +2309,19 @@ void CustomEventsParser::ParseCustomReqNode(rapidxml::xml_node<char> *node, Cust
     }
     if (node->first_attribute("lvl"))
     {
-        req->lvl = boost::lexical_cast<int>(node->first_attribute("lvl")->value());
+        req->lvl = XMLValue::Attribute<int>(node, "lvl");
     }
     if (node->first_attribute("max_lvl"))
     {
-        req->max_lvl = boost::lexical_cast<int>(node->first_attribute("max_lvl")->value());
+        req->max_lvl = XMLValue::Attribute<int>(node, "max_lvl");
     }
     if (node->first_attribute("mult"))
     {
-        req->mult = boost::lexical_cast<int>(node->first_attribute("mult")->value());
+        req->mult = XMLValue::Attribute<int>(node, "mult");
     }
     if (node->first_attribute("const"))
     {
-        req->constant = boost::lexical_cast<int>(node->first_attribute("const")->value());
+        req->constant = XMLValue::Attribute<int>(node, "const");
     }
     if (node->first_attribute("load"))
     {
@@ -2362,16 +2385,16 @@ void CustomEventsParser::ParseCustomEventLoadList(rapidxml::xml_node<char> *node
             }
             if (child->first_attribute("max_lvl"))
             {
-                event.max_lvl = boost::lexical_cast<int>(child->first_attribute("max_lvl")->value());
+                event.max_lvl = XMLValue::Attribute<int>(child, "max_lvl");
                 event.lvl = -2147483648;
             }
             if (child->first_attribute("lvl"))
             {
-                event.lvl = boost::lexical_cast<int>(child->first_attribute("lvl")->value());
+                event.lvl = XMLValue::Attribute<int>(child, "lvl");
             }
             if (child->first_attribute("max_group"))
             {
-                event.max_group = boost::lexical_cast<int>(child->first_attribute("max_group")->value());
+                event.max_group = XMLValue::Attribute<int>(child, "max_group");
             }
 
             if (event.event.empty())
@@ -2438,26 +2461,26 @@ void VariableModifier::ParseVariableModifierNode(rapidxml::xml_node<char> *node)
     }
     if (node->first_attribute("val"))
     {
-        minVal = boost::lexical_cast<int>(node->first_attribute("val")->value());
+        minVal = XMLValue::Attribute<int>(node, "val");
         maxVal = minVal;
     }
     if (node->first_attribute("value"))
     {
-        minVal = boost::lexical_cast<int>(node->first_attribute("value")->value());
+        minVal = XMLValue::Attribute<int>(node, "value");
         maxVal = minVal;
     }
     if (node->first_attribute("amount"))
     {
-        minVal = boost::lexical_cast<int>(node->first_attribute("amount")->value());
+        minVal = XMLValue::Attribute<int>(node, "amount");
         maxVal = minVal;
     }
     if (node->first_attribute("min"))
     {
-        minVal = boost::lexical_cast<int>(node->first_attribute("min")->value());
+        minVal = XMLValue::Attribute<int>(node, "min");
     }
     if (node->first_attribute("max"))
     {
-        maxVal = boost::lexical_cast<int>(node->first_attribute("max")->value());
+        maxVal = XMLValue::Attribute<int>(node, "max");
     }
 
     // Force attribute bypasses anything that might block the variable modifier from being applied
@@ -2736,9 +2759,9 @@ void SetCheckCargo(CustomEvent *event)
 
 void ShipObject::CheckCargo(const std::string& equipment, int &ret)
 {
-    std::vector<std::string> blueprintList = G_->GetBlueprints()->GetBlueprintList(equipment);
+    const std::vector<std::string> *blueprintList = BlueprintListRegistry::GetList(equipment);
 
-    if (ret != 0 && blueprintList.size() > 0) return; // list check; if already found then return
+    if (ret != 0 && blueprintList && blueprintList->size() > 0) return; // list check; if already found then return
 
     Equipment equip = G_->GetWorld()->commandGui->equipScreen;
     auto boxes = equip.vEquipmentBoxes;
@@ -2752,9 +2775,9 @@ void ShipObject::CheckCargo(const std::string& equipment, int &ret)
             Blueprint* cargoItem = box->GetBlueprint();
             if (cargoItem)
             {
-                if (blueprintList.size() > 0)
+                if (blueprintList && blueprintList->size() > 0)
                 {
-                    for (auto const& x: blueprintList)
+                    for (auto const& x: *blueprintList)
                     {
                         if (cargoItem->name == x)
                         {
@@ -2801,11 +2824,11 @@ int ShipObject::HasItem(const std::string& equip)
 
     std::map<std::string, int> &equipList = G_->GetShipInfo(iShipId)->equipList;
 
-    std::vector<std::string> blueprintList = G_->GetBlueprints()->GetBlueprintList(equip);
+    const std::vector<std::string> *blueprintList = BlueprintListRegistry::GetList(equip);
 
-    if (blueprintList.size() > 0)
+    if (blueprintList && blueprintList->size() > 0)
     {
-        for (std::string &bp : blueprintList)
+        for (const std::string &bp : *blueprintList)
         {
             if (equipList.count(bp) && equipList[bp] > 0)
             {
@@ -2839,23 +2862,23 @@ HOOK_METHOD_PRIORITY(ShipObject, HasEquipment, -100, (const std::string& equipme
         if (boost::algorithm::starts_with(equipment, "ANY "))
         {
             std::string child = equipment.substr(4);
-            std::vector<std::string> blueprintList = G_->GetBlueprints()->GetBlueprintList(child);
-            if (!blueprintList.size()) blueprintList.push_back(child);
-            return CustomReq::HasEquipment_Any(*(ShipObject*)this, blueprintList);
+            const std::vector<std::string> *blueprintList = BlueprintListRegistry::GetList(child);
+            if (blueprintList && !blueprintList->empty()) return CustomReq::HasEquipment_Any(*(ShipObject*)this, *blueprintList);
+            return CustomReq::HasEquipment_Any(*(ShipObject*)this, std::vector<std::string>{child});
         }
         if (boost::algorithm::starts_with(equipment, "ALL "))
         {
             std::string child = equipment.substr(4);
-            std::vector<std::string> blueprintList = G_->GetBlueprints()->GetBlueprintList(child);
-            if (!blueprintList.size()) blueprintList.push_back(child);
-            return CustomReq::HasEquipment_All(*(ShipObject*)this, blueprintList);
+            const std::vector<std::string> *blueprintList = BlueprintListRegistry::GetList(child);
+            if (blueprintList && !blueprintList->empty()) return CustomReq::HasEquipment_All(*(ShipObject*)this, *blueprintList);
+            return CustomReq::HasEquipment_All(*(ShipObject*)this, std::vector<std::string>{child});
         }
         if (boost::algorithm::starts_with(equipment, "SUM "))
         {
             std::string child = equipment.substr(4);
-            std::vector<std::string> blueprintList = G_->GetBlueprints()->GetBlueprintList(child);
-            if (!blueprintList.size()) blueprintList.push_back(child);
-            return CustomReq::HasEquipment_Sum(*(ShipObject*)this, blueprintList);
+            const std::vector<std::string> *blueprintList = BlueprintListRegistry::GetList(child);
+            if (blueprintList && !blueprintList->empty()) return CustomReq::HasEquipment_Sum(*(ShipObject*)this, *blueprintList);
+            return CustomReq::HasEquipment_Sum(*(ShipObject*)this, std::vector<std::string>{child});
         }
         if (boost::algorithm::starts_with(equipment, "SEC "))
         {
@@ -2941,7 +2964,7 @@ HOOK_METHOD_PRIORITY(ShipObject, HasEquipment, -1000, (const std::string& equipm
     {
         // HAS_EQUIPMENT(ShipManager, equipment, retValue)
         auto context = G_->getLuaContext();
-        SWIG_NewPointerObj(context->GetLua(), G_->GetShipManager(this->iShipId), context->getLibScript()->types.pShipManager, 0);
+        LuaLibScript::push_cached_pointer(context->GetLua(), G_->GetShipManager(this->iShipId), context->getLibScript()->types.pShipManager);
         lua_pushstring(context->GetLua(), equipment.c_str());
         lua_pushinteger(context->GetLua(), ret);
         context->getLibScript()->call_on_internal_chain_event_callbacks(InternalEvents::HAS_EQUIPMENT, 3, 1);
@@ -3392,11 +3415,33 @@ HOOK_METHOD(EventGenerator, GetBaseEvent, (const std::string& name, int worldLev
     return super(name, worldLevel, ignoreUnique, seed);
 }
 
+// Custom event of each location as of the last map render. The result only depends on the event name,
+// so an entry stays valid until the name changes (new event, renamed or regenerated beacon, quest).
+struct LocationLabelCache
+{
+    std::string eventName;
+    CustomEvent *customEvent = nullptr;
+};
+
+static std::unordered_map<Location*, LocationLabelCache> locationLabelCache;
+
+static CustomEvent *GetLocationCustomEvent(Location *loc)
+{
+    LocationLabelCache &cache = locationLabelCache[loc];
+    if (cache.eventName != loc->event->eventName || cache.eventName.empty())
+    {
+        cache.eventName = loc->event->eventName;
+        cache.customEvent = CustomEventsParser::GetInstance()->GetCustomEvent(cache.eventName);
+    }
+    return cache.customEvent;
+}
+
 HOOK_METHOD(StarMap, RenderLabels, () -> void)
 {
     LOG_HOOK("HOOK_METHOD -> StarMap::RenderLabels -> Begin (CustomEvents.cpp)\n")
     struct LocLabelValues
     {
+        Location *loc;
         bool questLoc;
         bool beacon;
         bool repair;
@@ -3404,7 +3449,8 @@ HOOK_METHOD(StarMap, RenderLabels, () -> void)
         bool store;
         bool distressBeacon;
     };
-    std::unordered_map<Location*, LocLabelValues> locLabelValues = std::unordered_map<Location*, LocLabelValues>();
+    static std::vector<LocLabelValues> locLabelValues;
+    locLabelValues.clear();
 
     CSurface::GL_PushMatrix();
     CSurface::GL_Translate(position.x, position.y, 0.f);
@@ -3417,7 +3463,7 @@ HOOK_METHOD(StarMap, RenderLabels, () -> void)
         for (auto i : locations)
         {
             if (i->event == nullptr) continue;
-            CustomEvent *customEvent = CustomEventsParser::GetInstance()->GetCustomEvent(i->event->eventName);
+            CustomEvent *customEvent = GetLocationCustomEvent(i);
 
             bool hideVanillaLabel = (customEvent && customEvent->beacon && customEvent->beacon->hideVanillaLabel && (i->visited < 1 || customEvent->beacon->persistent));
 
@@ -3474,12 +3520,7 @@ HOOK_METHOD(StarMap, RenderLabels, () -> void)
 
             if (hideVanillaLabel && (i->questLoc || i->beacon || i->event->repair || i->event->pStore || i->event->store || i->event->distressBeacon))
             {
-                locLabelValues[i].questLoc = i->questLoc;
-                locLabelValues[i].beacon = i->beacon;
-                locLabelValues[i].repair = i->event->repair;
-                locLabelValues[i].pStore = i->event->pStore;
-                locLabelValues[i].store = i->event->store;
-                locLabelValues[i].distressBeacon = i->event->distressBeacon;
+                locLabelValues.push_back({i, i->questLoc, i->beacon, i->event->repair, i->event->pStore, i->event->store, i->event->distressBeacon});
 
                 i->questLoc = false;
                 i->beacon = false;
@@ -3501,8 +3542,7 @@ HOOK_METHOD(StarMap, RenderLabels, () -> void)
     {
         if (i->fleetChanging && i->visited < 1 && i->event)
         {
-            LocationEvent *locEvent = i->event;
-            auto customEvent = CustomEventsParser::GetInstance()->GetCustomEvent(locEvent->eventName);
+            auto customEvent = GetLocationCustomEvent(i);
             if (customEvent && customEvent->preventFleet)
             {
                 i->fleetChanging = false;
@@ -3510,26 +3550,30 @@ HOOK_METHOD(StarMap, RenderLabels, () -> void)
         }
     }
 
-    for (auto i : locLabelValues)
+    for (auto &i : locLabelValues)
     {
-        i.first->questLoc = i.second.questLoc;
-        i.first->beacon = i.second.beacon;
-        if (i.first->event != nullptr)
+        i.loc->questLoc = i.questLoc;
+        i.loc->beacon = i.beacon;
+        if (i.loc->event != nullptr)
         {
-            i.first->event->repair = i.second.repair;
-            i.first->event->pStore = i.second.pStore;
-            i.first->event->store = i.second.store;
-            i.first->event->distressBeacon = i.second.distressBeacon;
+            i.loc->event->repair = i.repair;
+            i.loc->event->pStore = i.pStore;
+            i.loc->event->store = i.store;
+            i.loc->event->distressBeacon = i.distressBeacon;
         }
     }
 }
 
 static Location* originalExit = nullptr;
 
+// Map generation has to run here, on the main thread at jump time: it draws from the global random32() stream
+// shared with the rest of the game, marks unique events as used, and event requirements and lua callbacks read
+// the player's ship as it is when entering the sector, so generating it ahead of time would not give the same map.
 HOOK_METHOD(StarMap, GenerateMap, (bool tutorial, bool seed) -> LocationEvent*)
 {
     LOG_HOOK("HOOK_METHOD -> StarMap::GenerateMap -> Begin (CustomEvents.cpp)\n")
     originalExit = nullptr;
+    locationLabelCache.clear();
 
     if (!loadingGame)
     {
@@ -5392,7 +5436,10 @@ HOOK_METHOD(WorldManager, ModifyResources, (LocationEvent *event) -> LocationEve
 HOOK_METHOD(TextLibrary, GetText, (const std::string& name, const std::string& lang) -> std::string)
 {
     LOG_HOOK("HOOK_METHOD -> TextLibrary::GetText -> Begin (CustomEvents.cpp)\n")
-    if (!shouldReplaceCreditsText || replaceGameOverCreditsText.empty() || name != "credit_victory") return super(name, lang);
+    if (name != "credit_victory") return super(name, lang);
+
+    TextLibraryCache::MarkVolatile();
+    if (!shouldReplaceCreditsText || replaceGameOverCreditsText.empty()) return super(name, lang);
 
     return super(replaceGameOverCreditsText, lang);
 }
@@ -5800,6 +5847,7 @@ HOOK_METHOD(StarMap, LoadGame, (int fh) -> Location*)
             vec.back().Load(fh);
         }
     }
+    CustomBackgroundObjectManager::instance->needSort = true;
 
     // eventButtons
     EventButtonManager::instance->Load(fh);
@@ -280,6 +280,40 @@ public:
     bool inverseReq = false;
 };
 
+// Ship and crew values polled by TriggeredEvent::Update, gathered once per frame
+struct TriggeredEventInputs
+{
+    ShipManager* playerShip = nullptr;
+    ShipManager* enemyShip = nullptr;
+    int playerHull = 0;
+    int enemyHull = 0;
+    int playerCrew = 0;
+    int enemyCrew = 0;
+    int playerCloneCount = 0;
+    int enemyCloneCount = 0;
+
+    int GetPlayerCrew(bool clones) const
+    {
+        return clones ? playerCrew : playerCrew - playerCloneCount;
+    }
+    int GetEnemyCrew(bool clones) const
+    {
+        return clones ? enemyCrew : enemyCrew - enemyCloneCount;
+    }
+
+    bool operator==(const TriggeredEventInputs& other) const
+    {
+        return playerShip == other.playerShip && enemyShip == other.enemyShip &&
+               playerHull == other.playerHull && enemyHull == other.enemyHull &&
+               playerCrew == other.playerCrew && enemyCrew == other.enemyCrew &&
+               playerCloneCount == other.playerCloneCount && enemyCloneCount == other.enemyCloneCount;
+    }
+    bool operator!=(const TriggeredEventInputs& other) const
+    {
+        return !(*this == other);
+    }
+};
+
 class TriggeredEvent
 {
 public:
@@ -294,7 +328,9 @@ public:
     static void SaveAll(int file);
     static void LoadAll(int file);
 
-    static int playerCloneCount;
+    static TriggeredEventInputs inputs;
+    static unsigned int inputsVersion; // bumped whenever inputs change, never 0
+    static void UpdateInputs();
 
 public:
     TriggeredEventDefinition* def;
@@ -324,6 +360,7 @@ public:
     int reqLvl;
 
     bool triggered = false;
+    unsigned int checkedInputsVersion = 0;
 
     WarningMessage* warning = nullptr;
     float warningTime = -1.f;
@@ -395,19 +432,6 @@ public:
         return triggerTimer->currGoal - triggerTimer->currTime;
     }
 
-    int GetPlayerCrew(bool clones)
-    {
-        int ret = G_->GetCrewFactory()->playerCrew;
-        if (!clones) ret -= playerCloneCount;
-        return ret;
-    }
-    int GetEnemyCrew(bool clones)
-    {
-        int ret = G_->GetCrewFactory()->enemyCrew;
-        if (!clones) ret -= G_->GetCrewFactory()->enemyCloneCount;
-        return ret;
-    }
-
     void Reset();
     void Update();
     void OnRender();
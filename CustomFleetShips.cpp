@@ -1,6 +1,6 @@
 #include "CustomFleetShips.h"
 #include "CustomEvents.h"
-#include "boost/lexical_cast.hpp"
+#include "XMLValue.h"
 
 static std::unordered_map<std::string, FleetDefinition> g_fleetDefs = std::unordered_map<std::string, FleetDefinition>();
 
@@ -27,7 +27,7 @@ void ParseFleetShipNode(rapidxml::xml_node<char>* node)
 
             if (child->first_attribute("layer"))
             {
-                layer = boost::lexical_cast<int>(child->first_attribute("layer")->value());
+                layer = XMLValue::Attribute<int>(child, "layer");
             }
 
             fleetDef.shipTextures[layer].push_back(val);
@@ -38,10 +38,10 @@ void ParseFleetShipNode(rapidxml::xml_node<char>* node)
 
             if (child->first_attribute("layer"))
             {
-                layer = boost::lexical_cast<int>(child->first_attribute("layer")->value());
+                layer = XMLValue::Attribute<int>(child, "layer");
             }
 
-            fleetDef.numShips[layer] = boost::lexical_cast<int>(val);
+            fleetDef.numShips[layer] = XMLValue::Value<int>(child);
         }
         if (name == "bigShip")
         {
@@ -226,15 +226,20 @@ HOOK_METHOD(SpaceManager, OnRenderFleet, () -> void)
     float tintOpacity = maxTint;
     float constant = maxTint / fleetCount;
 
+    ResourceControl *resources = G_->GetResources();
+    const GL_Color shadowColor = GL_Color(0.f, 0.f, 0.f, 1.f);
+
+    // The three draws stay interleaved per ship: each shadow is stenciled against the silhouettes of
+    // the ships drawn before it, so splitting them into whole-fleet passes would change which shadows show.
     for (auto& layer : g_currentFleetShips)
     {
-        for (auto i : layer)
+        for (const CustomFleetShip &i : layer)
         {
             CSurface::GL_SetStencilMode(STENCIL_USE, 0x80, 0x80);
-            G_->GetResources()->RenderImage(i.fleetShip.image, i.fleetShip.location.x, i.fleetShip.location.y + 5, 0, GL_Color(0.f, 0.f, 0.f, 1.f), 0.6f, i.mirror);
+            resources->RenderImage(i.fleetShip.image, i.fleetShip.location.x, i.fleetShip.location.y + 5, 0, shadowColor, 0.6f, i.mirror);
 
             CSurface::GL_SetStencilMode(STENCIL_SET, 0x80, 0x80);
-            G_->GetResources()->RenderImage(i.fleetShip.image, i.fleetShip.location.x, i.fleetShip.location.y, 0, tintColor, 1.f, i.mirror);
+            resources->RenderImage(i.fleetShip.image, i.fleetShip.location.x, i.fleetShip.location.y, 0, tintColor, 1.f, i.mirror);
 
             CSurface::GL_SetStencilMode(STENCIL_IGNORE, 0x80, 0x80);
 
@@ -246,7 +251,7 @@ HOOK_METHOD(SpaceManager, OnRenderFleet, () -> void)
                 tintOpacity -= constant;
             }
 
-            G_->GetResources()->RenderImage(i.fleetShip.image, i.fleetShip.location.x, i.fleetShip.location.y, 0, color, 1.f, i.mirror);
+            resources->RenderImage(i.fleetShip.image, i.fleetShip.location.x, i.fleetShip.location.y, 0, color, 1.f, i.mirror);
         }
     }
 
@@ -501,19 +501,70 @@ HOOK_METHOD(TextLibrary, GetText, (const std::string& name, const std::string& l
     {
         // Return empty string for "HULL" and "SHIELDS"
         // Use spaces to make freetype::easy_measurePrintLines return roughly the correct value
-        if (g_emptyJpEnemyStatusText && (name == "status_hull" || name == "status_shields"))
+        if (name == "status_hull" || name == "status_shields")
         {
-            return std::string((int)std::ceil(0.6f*super(name, lang).size()), ' ');
+            TextLibraryCache::MarkVolatile();
+            if (g_emptyJpEnemyStatusText) return std::string((int)std::ceil(0.6f*super(name, lang).size()), ' ');
         }
         // Return empty string for "CHARGING" and "READY!"
-        if (g_emptyJpChargingText && (name == "ftl_charging" || name == "ftl_ready"))
+        if (name == "ftl_charging" || name == "ftl_ready")
         {
-            return "";
+            TextLibraryCache::MarkVolatile();
+            if (g_emptyJpChargingText) return "";
         }
     }
     return super(name, lang);
 }
 
+bool TextLibraryCache::resolvedVolatile = false;
+std::unordered_map<std::string, TextLibraryCache::LanguageCache> TextLibraryCache::caches;
+
+const std::string& TextLibraryCache::GetText(const std::string& name)
+{
+    return GetText(name, G_->GetTextLibrary()->currentLanguage);
+}
+
+const std::string& TextLibraryCache::GetText(const std::string& name, const std::string& lang)
+{
+    LanguageCache &cache = caches[lang];
+
+    auto it = cache.find(name);
+    if (it == cache.end())
+    {
+        resolvedVolatile = false;
+        CachedText entry;
+        entry.text = G_->GetTextLibrary()->GetText(name, lang);
+        entry.isVolatile = resolvedVolatile;
+        it = cache.emplace(name, std::move(entry)).first;
+    }
+    else if (it->second.isVolatile)
+    {
+        it->second.text = G_->GetTextLibrary()->GetText(name, lang);
+    }
+    return it->second.text;
+}
+
+void TextLibraryCache::Invalidate()
+{
+    caches.clear();
+}
+
+HOOK_METHOD(CApp, OnLanguageChange, () -> void)
+{
+    LOG_HOOK("HOOK_METHOD -> CApp::OnLanguageChange -> Begin (CustomLocalization.cpp)\n")
+    TextLibraryCache::Invalidate();
+    super();
+}
+
+HOOK_METHOD(CApp, OnInit, () -> int)
+{
+    LOG_HOOK("HOOK_METHOD -> CApp::OnInit -> Begin (CustomLocalization.cpp)\n")
+    int ret = super();
+    // text files are loaded during init, drop anything resolved before that
+    TextLibraryCache::Invalidate();
+    return ret;
+}
+
 HOOK_METHOD(CombatControl, RenderShipStatus, (Pointf pos, GL_Color color) -> void)
 {
     LOG_HOOK("HOOK_METHOD -> CombatControl::RenderShipStatus -> Begin (CustomLocalization.cpp)\n")
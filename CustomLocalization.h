@@ -1,4 +1,35 @@
 #pragma once
 #include "Global.h"
+#include <unordered_map>
 
 void ParseLanguagesNode(ResourceControl *resources, rapidxml::xml_node<char> *node);
+
+class TextLibraryCache
+{
+public:
+    // Resolved text (after all TextLibrary::GetText hooks) for the current language.
+    // The returned reference stays valid until the next language change or text reload.
+    static const std::string& GetText(const std::string& name);
+    static const std::string& GetText(const std::string& name, const std::string& lang);
+
+    // Called by TextLibrary::GetText hooks for any id whose text they may rewrite depending on game state,
+    // whether or not they rewrite it this time. Such ids are resolved again on every GetText call.
+    static void MarkVolatile()
+    {
+        resolvedVolatile = true;
+    }
+
+    static void Invalidate();
+
+private:
+    struct CachedText
+    {
+        std::string text;
+        bool isVolatile = false;
+    };
+
+    typedef std::unordered_map<std::string, CachedText> LanguageCache;
+
+    static bool resolvedVolatile;
+    static std::unordered_map<std::string, LanguageCache> caches;
+};
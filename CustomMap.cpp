@@ -219,8 +219,17 @@ HOOK_METHOD(StarMap, OnRender, () -> void)
     }
 }
 
+struct LocationPairHash
+{
+    size_t operator()(const std::pair<Location*, Location*> &p) const
+    {
+        size_t h = std::hash<Location*>()(p.first);
+        return h ^ (std::hash<Location*>()(p.second) + 0x9e3779b9 + (h << 6) + (h >> 2));
+    }
+};
+
 static bool g_firstTimeConnection = false;
-static std::vector<std::unordered_set<Location*>> g_locConnections;
+static std::vector<std::pair<Location*, Location*>> g_locConnections;
 static bool g_useNonColorVertices = false;
 
 
@@ -229,9 +238,11 @@ HOOK_STATIC(CSurface, GL_BlitMultiColorImage, (GL_Texture *tex, const std::vecto
     LOG_HOOK("HOOK_STATIC -> CSurface::GL_BlitMultiColorImage -> Begin (CustomMap.cpp)\n")
     if (g_useNonColorVertices)
     {
-        auto newVec = std::vector<GL_TexVertex>();
+        static std::vector<GL_TexVertex> newVec;
+        newVec.clear();
+        newVec.reserve(texVertices.size());
 
-        for (auto i : texVertices)
+        for (const GL_ColorTexVertex &i : texVertices)
         {
             GL_TexVertex newVertex;
             newVertex.x = i.x;
@@ -255,14 +266,12 @@ HOOK_METHOD(StarMap, DrawConnection, (const Pointf& pos1, const Pointf& pos2, co
     LOG_HOOK("HOOK_METHOD -> StarMap::DrawConnection -> Begin (CustomMap.cpp)\n")
     if (g_firstTimeConnection && CustomOptionsManager::GetInstance()->showAllConnections.currentValue == true)
     {
-        for (auto i : g_locConnections)
+        for (const auto &i : g_locConnections)
         {
-            std::vector<Location*> vec = std::vector<Location*>(i.begin(), i.end());
-
-            if (vec[0] != hoverLoc && vec[1] != hoverLoc && vec[0] != currentLoc && vec[1] != currentLoc)
+            if (i.first != hoverLoc && i.second != hoverLoc && i.first != currentLoc && i.second != currentLoc)
             {
                 g_useNonColorVertices = true;
-                super(vec[0]->loc, vec[1]->loc, GL_Color(255.f, 255.f, 255.f, 1.f));
+                super(i.first->loc, i.second->loc, GL_Color(255.f, 255.f, 255.f, 1.f));
                 g_useNonColorVertices = false;
             }
         }
@@ -288,14 +297,18 @@ HOOK_METHOD(StarMap, Open, () -> void)
 
     g_locConnections.clear();
 
+    // each connection is listed by both of its locations, key it by the lower address so it's only drawn once
+    std::unordered_set<std::pair<Location*, Location*>, LocationPairHash> seen;
+
     for (auto i : locations)
     {
         for (auto x : i->connectedLocations)
         {
-            auto newSet = std::unordered_set<Location*>({ i, x });
-            if (std::find(g_locConnections.begin(), g_locConnections.end(), newSet) == g_locConnections.end())
+            if (x == i) continue;
+
+            if (seen.insert(std::minmax(i, x)).second)
             {
-                g_locConnections.push_back(newSet);
+                g_locConnections.emplace_back(i, x);
             }
         }
     }
@@ -323,9 +336,6 @@ HOOK_METHOD(StarMap, MouseMove, (int x, int y) -> void)
         {
             hoverLoc = i;
 
-            ShipManager *ship = G_->GetShipManager(0);
-            if (hoverLoc->visited != 0 && ship->HasAugmentation("FTL_JUMPER")) canJump = hoverLoc != currentLoc;
-
             for (auto x : currentLoc->connectedLocations)
             {
                 if (x == hoverLoc)
@@ -335,6 +345,12 @@ HOOK_METHOD(StarMap, MouseMove, (int x, int y) -> void)
                 }
             }
 
+            // the augment lookup only matters for visited beacons that aren't already adjacent
+            if (!canJump && hoverLoc->visited != 0 && hoverLoc != currentLoc)
+            {
+                canJump = G_->GetShipManager(0)->HasAugmentation("FTL_JUMPER");
+            }
+
             if (canJump) potentialLoc = hoverLoc;
             break;
         }
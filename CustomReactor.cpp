@@ -1,6 +1,8 @@
 #include "CustomReactor.h"
+#include "CustomLocalization.h"
 #include "CustomShipSelect.h"
 #include "CustomShips.h"
+#include "Resources.h"
 #include <cmath>
 #include <boost/lexical_cast.hpp>
 #include <boost/algorithm/string.hpp>
@@ -96,9 +98,12 @@ HOOK_METHOD(ReactorButton, OnRender, ()->void)
     emptyColour(255.f/255, 255.f/255, 100.f/255, 0.25f);
     GL_Color fullColour = G_->GetSettings()->colorblind ? COLOR_CB_WHITE : COLOR_GREEN;
 
-    GL_Texture* reactorImageOff = G_->GetResources()->GetImageId("upgradeUI/equipment/equipment_reactor_off.png");
-    GL_Texture* reactorImage = G_->GetResources()->GetImageId("upgradeUI/equipment/equipment_reactor_on.png");
-    GL_Texture* reactorImageSel = G_->GetResources()->GetImageId("upgradeUI/equipment/equipment_reactor_select2.png");
+    static ImageHandle reactorImageOffHandle("upgradeUI/equipment/equipment_reactor_off.png");
+    static ImageHandle reactorImageHandle("upgradeUI/equipment/equipment_reactor_on.png");
+    static ImageHandle reactorImageSelHandle("upgradeUI/equipment/equipment_reactor_select2.png");
+    GL_Texture* reactorImageOff = reactorImageOffHandle.Get();
+    GL_Texture* reactorImage = reactorImageHandle.Get();
+    GL_Texture* reactorImageSel = reactorImageSelHandle.Get();
     GL_Texture* activeImage = bActive ? (bHover ? reactorImageSel : reactorImage) : reactorImageOff;
     int baseX = position.x, baseY = position.y;
 
@@ -170,7 +175,7 @@ HOOK_METHOD(ReactorButton, OnRender, ()->void)
     }
     std::string currentPrice = std::to_string(currentCost);
     CSurface::GL_SetColor(currentColour);
-    if(!bActive) freetype::easy_printCenter(52, baseX + 238, baseY + 88, G_->GetTextLibrary()->GetText("upgrade_max"));
+    if(!bActive) freetype::easy_printCenter(52, baseX + 238, baseY + 88, TextLibraryCache::GetText("upgrade_max"));
     else if(tempLevel == maxLevel) freetype::easy_print(52, baseX + 233, baseY + 88, "--");
     else if (currentCost >= 100) freetype::easy_printAutoShrink(0, baseX + 235, baseY + 93, 39, false, currentPrice);
     else freetype::easy_print(0, baseX + 235, baseY + 93, currentPrice);
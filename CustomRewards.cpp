@@ -1,6 +1,6 @@
 #include "CustomRewards.h"
+#include "XMLValue.h"
 
-#include <boost/lexical_cast.hpp>
 
 CustomRewardsManager *CustomRewardsManager::instance = new CustomRewardsManager();
 
@@ -151,7 +151,7 @@ int CustomRewardsManager::ParseRewardScalingNode(rapidxml::xml_node<char> *node,
     int difficulty = 1;
     if (node->first_attribute("difficulty"))
     {
-        difficulty = boost::lexical_cast<int>(node->first_attribute("difficulty")->value());
+        difficulty = XMLValue::Attribute<int>(node, "difficulty");
     }
 
     for (auto child = node->first_node(); child; child = child->next_sibling())
@@ -181,25 +181,25 @@ bool CustomRewardsManager::ParseScrapScaling(rapidxml::xml_node<char> *node, Cus
     if (node->first_attribute("baseAmount"))
     {
         isValid = true;
-        scaling.baseAmount = boost::lexical_cast<float>(node->first_attribute("baseAmount")->value());
+        scaling.baseAmount = XMLValue::Attribute<float>(node, "baseAmount");
     }
 
     if (node->first_attribute("sectorAmount"))
     {
         isValid = true;
-        scaling.sectorAmount = boost::lexical_cast<float>(node->first_attribute("sectorAmount")->value());
+        scaling.sectorAmount = XMLValue::Attribute<float>(node, "sectorAmount");
     }
 
     if (node->first_attribute("difficultyAmount"))
     {
         isValid = true;
-        scaling.difficultyAmount = boost::lexical_cast<int>(node->first_attribute("difficultyAmount")->value());
+        scaling.difficultyAmount = XMLValue::Attribute<int>(node, "difficultyAmount");
     }
 
     for (auto child = node->first_node(); child; child = child->next_sibling())
     {
         isValid = true;
-        scaling.amounts.push_back(boost::lexical_cast<float>(child->value()));
+        scaling.amounts.push_back(XMLValue::Value<float>(child));
     }
 
     return isValid;
@@ -212,13 +212,13 @@ bool CustomRewardsManager::ParseResourceNode(rapidxml::xml_node<char> *node, Cus
     if (node->first_attribute("min"))
     {
         isValid = true;
-        reward.minimum = boost::lexical_cast<int>(node->first_attribute("min")->value());
+        reward.minimum = XMLValue::Attribute<int>(node, "min");
     }
 
     if (node->first_attribute("max"))
     {
         isValid = true;
-        reward.maximum = boost::lexical_cast<int>(node->first_attribute("max")->value());
+        reward.maximum = XMLValue::Attribute<int>(node, "max");
     }
 
     return isValid;
@@ -228,7 +228,7 @@ void CustomRewardsManager::ParseBonusRewardNode(rapidxml::xml_node<char> *node,
 {
     if (node->first_attribute("roll"))
     {
-        rewards.roll = boost::lexical_cast<int>(node->first_attribute("roll")->value());
+        rewards.roll = XMLValue::Attribute<int>(node, "roll");
     }
     for (auto child = node->first_node(); child; child = child->next_sibling())
     {
@@ -238,7 +238,7 @@ void CustomRewardsManager::ParseBonusRewardNode(rapidxml::xml_node<char> *node,
 
         if (child->first_attribute("chance"))
         {
-            bonus.second = boost::lexical_cast<int>(child->first_attribute("chance")->value());
+            bonus.second = XMLValue::Attribute<int>(child, "chance");
         }
 
         rewards.bonusRewards.push_back(bonus);
@@ -257,12 +257,12 @@ void CustomRewardsManager::ParseRewardGenerator(rapidxml::xml_node<char> *node,
 
     if (node->first_attribute("minResources"))
     {
-        newRewardGenerator.minResources = boost::lexical_cast<int>(node->first_attribute("minResources")->value());
+        newRewardGenerator.minResources = XMLValue::Attribute<int>(node, "minResources");
     }
 
     if (node->first_attribute("maxResources"))
     {
-        newRewardGenerator.maxResources = boost::lexical_cast<int>(node->first_attribute("maxResources")->value());
+        newRewardGenerator.maxResources = XMLValue::Attribute<int>(node, "maxResources");
     }
 
     for (auto child = node->first_node(); child; child = child->next_sibling())
@@ -1,6 +1,6 @@
 #include "CustomSectors.h"
+#include "XMLValue.h"
 
-#include <boost/lexical_cast.hpp>
 
 CustomSectorManager *CustomSectorManager::instance = new CustomSectorManager();
 
@@ -19,7 +19,7 @@ void CustomSectorManager::ParseCustomSectorMapNode(rapidxml::xml_node<char> *nod
             CustomSectorGeneratorList sectorLists = CustomSectorGeneratorList();
             if (child->first_attribute("maxSector"))
             {
-                sectorLists.maxSector = boost::lexical_cast<int>(child->first_attribute("maxSector")->value());
+                sectorLists.maxSector = XMLValue::Attribute<int>(child, "maxSector");
             }
             for (auto child2 = child->first_node(); child2; child2 = child2->next_sibling())
             {
@@ -27,7 +27,7 @@ void CustomSectorManager::ParseCustomSectorMapNode(rapidxml::xml_node<char> *nod
                 int chance = 1;
                 if (child2->first_attribute("chance"))
                 {
-                    chance = boost::lexical_cast<int>(child2->first_attribute("chance")->value());
+                    chance = XMLValue::Attribute<int>(child2, "chance");
                 }
                 sectorLists.totalChance += chance;
                 sectorLists.sectorTypes.push_back({chance, sectorList});
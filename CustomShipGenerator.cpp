@@ -1,8 +1,8 @@
 #include "CustomShipGenerator.h"
 #include "CustomShipSelect.h"
+#include "XMLValue.h"
 #include <boost/math/special_functions/fpclassify.hpp>
 
-#include <boost/lexical_cast.hpp>
 
 bool CustomShipGenerator::enabled = false;
 std::unordered_map<std::string,CustomShipGenerator> CustomShipGenerator::customShipGenerators = std::unordered_map<std::string,CustomShipGenerator>();
@@ -70,18 +70,17 @@ void CustomShipGenerator::ParseGeneratorNode(rapidxml::xml_node<char> *node)
                 for (auto child = genNode->first_node(); child; child = child->next_sibling())
                 {
                     std::string name = child->name();
-                    std::string val = child->value();
 
                     if (name == "difficultyMod")
                     {
                         int level = 1;
                         if (child->first_attribute("difficulty"))
                         {
-                            level = boost::lexical_cast<int>(child->first_attribute("difficulty")->value());
+                            level = XMLValue::Attribute<int>(child, "difficulty");
                         }
                         if (level != -1)
                         {
-                            generator->difficultyMod.at(level) = boost::lexical_cast<float>(val);
+                            generator->difficultyMod.at(level) = XMLValue::Value<float>(child);
                         }
                     }
 
@@ -90,7 +89,7 @@ void CustomShipGenerator::ParseGeneratorNode(rapidxml::xml_node<char> *node)
                         int level = 1;
                         if (child->first_attribute("difficulty"))
                         {
-                            level = boost::lexical_cast<int>(child->first_attribute("difficulty")->value());
+                            level = XMLValue::Attribute<int>(child, "difficulty");
                         }
                         if (level != -1)
                         {
@@ -105,7 +104,7 @@ void CustomShipGenerator::ParseGeneratorNode(rapidxml::xml_node<char> *node)
                         int sysId = -1;
                         if (child->first_attribute("difficulty"))
                         {
-                            level = boost::lexical_cast<int>(child->first_attribute("difficulty")->value());
+                            level = XMLValue::Attribute<int>(child, "difficulty");
                         }
                         if (child->first_attribute("system"))
                         {
@@ -150,23 +149,22 @@ void CustomShipGenerator::SectorScaling::Parse(rapidxml::xml_node<char> *node)
     for (auto child = node->first_node(); child; child = child->next_sibling())
     {
         std::string name = child->name();
-        std::string val = child->value();
 
         if (name == "minValue")
         {
-            minValue = boost::lexical_cast<float>(val);
+            minValue = XMLValue::Value<float>(child);
         }
         if (name == "maxValue")
         {
-            maxValue = boost::lexical_cast<float>(val);
+            maxValue = XMLValue::Value<float>(child);
         }
         if (name == "minSector")
         {
-            minSector = boost::lexical_cast<float>(val);
+            minSector = XMLValue::Value<float>(child);
         }
         if (name == "maxSector")
         {
-            maxSector = boost::lexical_cast<float>(val);
+            maxSector = XMLValue::Value<float>(child);
         }
     }
 
@@ -188,7 +186,6 @@ void CustomShipGenerator::SystemLevelScaling::Parse(rapidxml::xml_node<char> *no
     for (auto child = node->first_node(); child; child = child->next_sibling())
     {
         std::string name = child->name();
-        std::string val = child->value();
 
         if (name == "sectorScaling")
         {
@@ -202,13 +199,13 @@ void CustomShipGenerator::SystemLevelScaling::Parse(rapidxml::xml_node<char> *no
                 newRandomScaling = true;
             }
 
-            if (val.empty()) continue;
+            if (child->value_size() == 0) continue;
 
             int level = -1;
-            int value = value = boost::lexical_cast<int>(val);;
+            int value = XMLValue::Value<int>(child);
             if (child->first_attribute("sector"))
             {
-                level = boost::lexical_cast<int>(child->first_attribute("sector")->value());
+                level = XMLValue::Attribute<int>(child, "sector");
             }
             randomScaling.push_back({level,value});
         }
@@ -731,7 +728,7 @@ HOOK_STATIC_PRIORITY(ShipGenerator, CreateShip, -100, (const std::string& name,
 
         // Place the ShipManager on the last spot of the stack
         lua_pop(context->GetLua(), 1);
-        SWIG_NewPointerObj(context->GetLua(), ret, context->getLibScript()->types.pShipManager, 0);
+        LuaLibScript::push_cached_pointer(context->GetLua(), ret, context->getLibScript()->types.pShipManager);
     }
 
     // The post-callback does not return anything, but can be used to modify the ShipManager after the main generator has run
@@ -7,8 +7,10 @@
 #include "EnemyShipIcons.h"
 #include "Resources.h"
 #include "CustomColors.h"
+#include "XMLTag.h"
+#include "XMLValue.h"
 #include <algorithm>
-#include <boost/lexical_cast.hpp>
+#include <unordered_set>
 #include <boost/algorithm/string.hpp>
 #include <boost/format.hpp>
 
@@ -249,11 +251,11 @@ void CustomShipSelect::ParseShipsNode(rapidxml::xml_node<char> *node)
 
                             if (shipChild->first_attribute("x"))
                             {
-                                pos.x = boost::lexical_cast<int>(shipChild->first_attribute("x")->value());
+                                pos.x = XMLValue::Attribute<int>(shipChild, "x");
                             }
                             if (shipChild->first_attribute("y"))
                             {
-                                pos.y = boost::lexical_cast<int>(shipChild->first_attribute("y")->value());
+                                pos.y = XMLValue::Attribute<int>(shipChild, "y");
                             }
                             if (shipChild->first_attribute("image"))
                             {
@@ -405,11 +407,11 @@ void CustomShipSelect::ParseShipsNode(rapidxml::xml_node<char> *node)
                         Point pos = Point();
                         if (animChild->first_attribute("x"))
                         {
-                            pos.x = boost::lexical_cast<int>(animChild->first_attribute("x")->value());
+                            pos.x = XMLValue::Attribute<int>(animChild, "x");
                         }
                         if (animChild->first_attribute("y"))
                         {
-                            pos.y = boost::lexical_cast<int>(animChild->first_attribute("y")->value());
+                            pos.y = XMLValue::Attribute<int>(animChild, "y");
                         }
                         customAnimDefs.push_back(std::pair<Point, std::string>(pos, animChild->value()));
                     }
@@ -490,7 +492,9 @@ bool CustomShipSelect::ParseCustomShipNode(rapidxml::xml_node<char> *node, Custo
         std::string name = std::string(shipNode->name());
         std::string val = std::string(shipNode->value());
 
-        if (name == "hiddenAug")
+        switch (XMLTag::Hash(name))
+        {
+        HS_XML_TAG(name, "hiddenAug")
         {
             isCustom = true;
             if (def.hiddenAugs.find(val) == def.hiddenAugs.end())
@@ -502,12 +506,14 @@ bool CustomShipSelect::ParseCustomShipNode(rapidxml::xml_node<char> *node, Custo
                 def.hiddenAugs[val]++;
             }
         }
-        if (name == "crewLimit")
+        break;
+        HS_XML_TAG(name, "crewLimit")
         {
             isCustom = true;
-            def.crewLimit = boost::lexical_cast<int>(val);
+            def.crewLimit = XMLValue::Value<int>(shipNode);
         }
-        if (name == "shipIcons")
+        break;
+        HS_XML_TAG(name, "shipIcons")
         {
             isCustom = true;
             for (auto iconNode = shipNode->first_node(); iconNode; iconNode = iconNode->next_sibling())
@@ -520,7 +526,8 @@ bool CustomShipSelect::ParseCustomShipNode(rapidxml::xml_node<char> *node, Custo
                 }
             }
         }
-        if (name == "rooms")
+        break;
+        HS_XML_TAG(name, "rooms")
         {
             isCustom = true;
             for (auto roomNode = shipNode->first_node(); roomNode; roomNode = roomNode->next_sibling())
@@ -529,7 +536,7 @@ bool CustomShipSelect::ParseCustomShipNode(rapidxml::xml_node<char> *node, Custo
                 {
                     RoomDefinition* roomDef = new RoomDefinition();
 
-                    int roomId = boost::lexical_cast<int>(roomNode->first_attribute("id")->value());
+                    int roomId = XMLValue::Attribute<int>(roomNode, "id");
 
                     for (auto roomDefNode = roomNode->first_node(); roomDefNode; roomDefNode = roomDefNode->next_sibling())
                     {
@@ -550,15 +557,15 @@ bool CustomShipSelect::ParseCustomShipNode(rapidxml::xml_node<char> *node, Custo
                         }
                         if (roomName == "hullDamageResistChance")
                         {
-                            roomDef->hullDamageResistChance = boost::lexical_cast<float>(roomValue);
+                            roomDef->hullDamageResistChance = XMLValue::Value<float>(roomDefNode);
                         }
                         if (roomName == "sysDamageResistChance")
                         {
-                            roomDef->sysDamageResistChance = boost::lexical_cast<float>(roomValue);
+                            roomDef->sysDamageResistChance = XMLValue::Value<float>(roomDefNode);
                         }
                         if (roomName == "ionDamageResistChance")
                         {
-                            roomDef->ionDamageResistChance = boost::lexical_cast<float>(roomValue);
+                            roomDef->ionDamageResistChance = XMLValue::Value<float>(roomDefNode);
                         }
                     }
 
@@ -569,22 +576,23 @@ bool CustomShipSelect::ParseCustomShipNode(rapidxml::xml_node<char> *node, Custo
                     std::vector<std::pair<int, std::vector<int>>>* backupList = new std::vector<std::pair<int, std::vector<int>>>;
                     for (auto backupNode = roomNode->first_node("backups")->first_node(); backupNode; backupNode = backupNode->next_sibling())
                     {
-                        int room = boost::lexical_cast<int>(backupNode->first_attribute("id")->value());
+                        int room = XMLValue::Attribute<int>(backupNode, "id");
                         std::vector<int> slots;
                         for (auto slotNode = backupNode->first_node("slot"); slotNode; slotNode = slotNode->next_sibling())
                         {
-                            slots.push_back(boost::lexical_cast<int>(slotNode->first_attribute("id")->value()));
+                            slots.push_back(XMLValue::Attribute<int>(slotNode, "id"));
                         }
                         backupList->push_back(std::make_pair(room, slots));
                     }
                     for (auto partitionNode = roomNode->first_node("rooms")->first_node(); partitionNode; partitionNode = partitionNode->next_sibling())
                     {
-                        def.roomStationBackups[boost::lexical_cast<int>(partitionNode->first_attribute("id")->value())] = backupList;
+                        def.roomStationBackups[XMLValue::Attribute<int>(partitionNode, "id")] = backupList;
                     }
                 }
             }
         }
-        if (name == "crew")
+        break;
+        HS_XML_TAG(name, "crew")
         {
             isCustom = true;
             for (auto crewNode = shipNode->first_node(); crewNode; crewNode = crewNode->next_sibling())
@@ -597,7 +605,7 @@ bool CustomShipSelect::ParseCustomShipNode(rapidxml::xml_node<char> *node, Custo
 
                 if (crewNode->first_attribute("room"))
                 {
-                    crewDef.roomId = boost::lexical_cast<int>(crewNode->first_attribute("room")->value());
+                    crewDef.roomId = XMLValue::Attribute<int>(crewNode, "room");
                 }
                 if (crewNode->first_attribute("name"))
                 {
@@ -611,82 +619,98 @@ bool CustomShipSelect::ParseCustomShipNode(rapidxml::xml_node<char> *node, Custo
                 def.crewList.push_back(crewDef);
             }
         }
-        if (name == "noJump")
+        break;
+        HS_XML_TAG(name, "noJump")
         {
             isCustom = true;
             def.noJump = true;
         }
-        if (name == "noFuelStalemate")
+        break;
+        HS_XML_TAG(name, "noFuelStalemate")
         {
             isCustom = true;
             def.noFuelStalemate = true;
         }
-        if (name == "hpCap")
+        break;
+        HS_XML_TAG(name, "hpCap")
         {
             isCustom = true;
-            def.hpCap = boost::lexical_cast<int>(val);
+            def.hpCap = XMLValue::Value<int>(shipNode);
         }
-        if (name == "startingFuel")
+        break;
+        HS_XML_TAG(name, "startingFuel")
         {
             isCustom = true;
-            def.startingFuel = boost::lexical_cast<int>(val);
+            def.startingFuel = XMLValue::Value<int>(shipNode);
         }
-        if (name == "startingScrap")
+        break;
+        HS_XML_TAG(name, "startingScrap")
         {
             isCustom = true;
-            def.startingScrap = boost::lexical_cast<int>(val);
+            def.startingScrap = XMLValue::Value<int>(shipNode);
         }
-        if (name == "autoShipForce")
+        break;
+        HS_XML_TAG(name, "autoShipForce")
         {
             isCustom = true;
             def.forceAutomated = EventsParser::ParseBoolean(val);
         }
-        if (name == "systemLimit")
+        break;
+        HS_XML_TAG(name, "systemLimit")
         {
             isCustom = true;
-            def.systemLimit = boost::lexical_cast<int>(val);
+            def.systemLimit = XMLValue::Value<int>(shipNode);
         }
-        if (name == "subsystemLimit")
+        break;
+        HS_XML_TAG(name, "subsystemLimit")
         {
             isCustom = true;
-            def.subsystemLimit = boost::lexical_cast<int>(val);
+            def.subsystemLimit = XMLValue::Value<int>(shipNode);
         }
-        if (name == "customReactor")
+        break;
+        HS_XML_TAG(name, "customReactor")
         {
             isCustom = true;
-            if(shipNode->first_attribute("maxLevel")) def.maxReactorLevel = boost::lexical_cast<int>(shipNode->first_attribute("maxLevel")->value());
+            if(shipNode->first_attribute("maxLevel")) def.maxReactorLevel = XMLValue::Attribute<int>(shipNode, "maxLevel");
             if(def.maxReactorLevel < 0) def.maxReactorLevel = 0;
             if(def.maxReactorLevel > 25) def.reactorPrices.resize(ceil(def.maxReactorLevel / 5 + 1), -1);
             for (auto reactorNode = shipNode->first_node(); reactorNode; reactorNode = reactorNode->next_sibling())
             {
                 std::string reactName = reactorNode->name();
 
-                if(reactName == "baseCost") def.reactorPrices[0] = boost::lexical_cast<int>(reactorNode->value());
-                if(reactName == "increment") def.reactorPriceIncrement = boost::lexical_cast<int>(reactorNode->value());
+                if(reactName == "baseCost") def.reactorPrices[0] = XMLValue::Value<int>(reactorNode);
+                if(reactName == "increment") def.reactorPriceIncrement = XMLValue::Value<int>(reactorNode);
                 if(reactName == "overrideCost") {
                     int coloumn = 0;
-                    if (reactorNode->first_attribute("coloumn")) coloumn = boost::lexical_cast<int>(reactorNode->first_attribute("coloumn")->value());
-                    if (reactorNode->first_attribute("column")) coloumn = boost::lexical_cast<int>(reactorNode->first_attribute("column")->value());
-                    def.reactorPrices[coloumn] = boost::lexical_cast<int>(reactorNode->value());
+                    if (reactorNode->first_attribute("coloumn")) coloumn = XMLValue::Attribute<int>(reactorNode, "coloumn");
+                    if (reactorNode->first_attribute("column")) coloumn = XMLValue::Attribute<int>(reactorNode, "column");
+                    def.reactorPrices[coloumn] = XMLValue::Value<int>(reactorNode);
                 }
             }
         }
-        if (name == "shipGenerator")
+        break;
+        HS_XML_TAG(name, "shipGenerator")
         {
             isCustom = true;
             def.shipGenerator = val;
         }
-        if (name == "artilleryGibMountFix")
+        break;
+        HS_XML_TAG(name, "artilleryGibMountFix")
         {
             isCustom = true;
             def.artilleryGibMountFix = true;
         }
-        if (name == "hideHullDuringExplosion")
+        break;
+        HS_XML_TAG(name, "hideHullDuringExplosion")
         {
             isCustom = true;
             def.hideHullDuringExplosion = true;
         }
-
+        break;
+        default:
+            // vanilla <shipBlueprint> nodes come through here too, their other tags belong to the game
+            if (strcmp(node->name(), "customShip") == 0) XMLTag::Unknown("customShip", name);
+        }
     }
 
     return isCustom;
@@ -696,7 +720,7 @@ void RoomAnimDef::ParseRoomAnimNode(rapidxml::xml_node<char> *node)
 {
     if (node->first_attribute("renderLayer"))
     {
-        renderLayer = boost::lexical_cast<int>(node->first_attribute("renderLayer")->value());
+        renderLayer = XMLValue::Attribute<int>(node, "renderLayer");
     }
 
     if (node->first_node() && node->first_node()->type() == rapidxml::node_type::node_element)
@@ -729,7 +753,7 @@ void RoomAnimDef::ParseRoomAnimNode(rapidxml::xml_node<char> *node)
                 }
                 if (child->first_attribute("animBorder"))
                 {
-                    animBorder = boost::lexical_cast<int>(child->first_attribute("animBorder")->value());
+                    animBorder = XMLValue::Attribute<int>(child, "animBorder");
                 }
             }
             if (strcmp(child->name(), "tileAnim") == 0)
@@ -768,7 +792,7 @@ void RoomAnimDef::ParseRoomAnimNode(rapidxml::xml_node<char> *node)
         }
         if (node->first_attribute("animBorder"))
         {
-            animBorder = boost::lexical_cast<int>(node->first_attribute("animBorder")->value());
+            animBorder = XMLValue::Attribute<int>(node, "animBorder");
         }
     }
 }
@@ -784,12 +808,13 @@ void CustomShipSelect::OnInit(ShipSelect* shipSelect_)
     if (!initialized)
     {
         auto toAdd = std::vector<std::string>();
+        std::unordered_set<std::string> ordered(customShipOrder.begin(), customShipOrder.end());
 
         for (const ShipButtonDefinition& i : shipButtonDefs)
         {
             if (!i.noAppend)
             {
-                if (std::find(customShipOrder.begin(), customShipOrder.end(), i.name) == customShipOrder.end())
+                if (ordered.insert(i.name).second)
                 {
                     toAdd.push_back(i.name);
                 }
@@ -798,6 +823,12 @@ void CustomShipSelect::OnInit(ShipSelect* shipSelect_)
 
         customShipOrder.insert(customShipOrder.end(), toAdd.begin(), toAdd.end());
 
+        customShipOrderIds.clear();
+        for (const std::string& name : customShipOrder)
+        {
+            customShipOrderIds.push_back(GetShipButtonIdFromName(name));
+        }
+
         for (auto i : customAnimDefs)
         {
             Animation* newAnim = new Animation(G_->GetAnimationControl()->GetAnimation(i.second));
@@ -820,215 +851,247 @@ void CustomShipSelect::OnInit(ShipSelect* shipSelect_)
         maxShipPage = 0;
     else if (!initialized)
     {
+        // Only the page layout is built here, the ShipButtons themselves are created by LoadShipPage when their page is visited
+        shipButtonPages.resize(maxShipPage);
+
         for (int i = 0; i < (customShipOrder.size()); i++)
         {
-            int shipId = 0;
-            shipId = GetShipButtonIdFromName(customShipOrder[i]);
+            int shipId = GetOrderedShipButtonId(i);
 
 
             if (shipId == -1)
                 continue;
 
-            ShipButtonDefinition &x = shipButtonDefs[shipId];
+            ShipButtonList* buttonList = new ShipButtonList(i / 10, i % 10, 100 + shipId);
+            shipButtons.push_back(buttonList);
+            shipButtonPages[buttonList->GetPage()].push_back(buttonList);
+            shipButtonIds.emplace(buttonList->GetId(), buttonList);
+        }
+    }
+    else
+    {
+        for (int page : loadedShipPages)
+        {
+            for (ShipButtonList* x : shipButtonPages[page])
+            {
+                UpdateButtonLocks(x);
+            }
+        }
+    }
 
-            // create and initialize ShipButtons for each of the blueprints
-            int curPage = i / 10;
 
-            ShipButton* buttons[3];
 
-            int onPage = i % 10;
 
-            for (int variant = 0; variant < 3; ++variant)
-            {
-                buttons[variant] = new ShipButton(100 + shipId, variant);
+    std::string buttonImg("customizeUI/button_ship_arrow");
+    leftButton = new Button();
+    leftButton->OnInit(buttonImg, Point(1100, 119));
 
-                if (!x.VariantExists(variant))
-                {
-                    buttons[variant]->bNoExist = true;
-                    buttons[variant]->bActive = false;
-                }
-            }
+    rightButton = new Button();
+    rightButton->OnInit(buttonImg, Point(1135, 119));
 
-            ShipButtonList* buttonList = new ShipButtonList(curPage, 100 + shipId, buttons[0], buttons[1], buttons[2]);
-            shipButtons.push_back(buttonList);
+    rightButton->bMirror = true;
 
+    if (maxShipPage == 0 || (maxShipPage == 1 && hideFirstPage))
+    {
+        leftButton->bActive = false;
+        rightButton->bActive = false;
+    }
 
-            Point pos = Point(0, 0);
-            if (onPage < 4)
-            {
-                pos = Point(136 + 205 * onPage, 161);
-            }
-            else if (onPage < 8)
-            {
-                pos = Point(136 + 205 * 3 - 205 * (onPage - 4), 161 + 177);
-            }
-            else if (onPage == 8)
-            {
-                pos = Point(136 + 205 * 3 + 225, 161);
-            }
-            else if (onPage == 9)
-            {
-                pos = Point(136 + 205 * 3 + 225, 161 + 177);
-            }
 
-            //int oldY = pos.y;
+    shipSelect = shipSelect_;
+    oldShipButtons = shipSelect->shipButtons;
 
-            for (int variant = 0; variant < 3; ++variant)
-            {
-                if (x.VariantExists(variant))
-                {
-                    std::string finalName = GetVariantName(x.name, variant);
+    UpdateFilteredAchievements();
 
-                    buttons[variant]->achievements.resize(5, nullptr);
+    initialized = true;
 
-                    if (CustomShipUnlocks::instance->CustomShipHasUnlock(finalName))
-                    {
-                        buttons[variant]->bShipLocked = !CustomShipUnlocks::instance->GetCustomShipUnlocked(finalName);
-                        buttons[variant]->bLayoutLocked = buttons[variant]->bShipLocked;
-                    }
+    if (shipPage > 0)
+    {
+        LoadShipPage(shipPage - 1);
+    }
+}
 
-                    if (x.splitVictoryAchievement)
-                    {
-                        buttons[variant]->achievements[3] = CustomShipUnlocks::instance->GetVictoryAchievement(finalName);
-                    }
-                    else
-                    {
-                        buttons[variant]->achievements[3] = CustomShipUnlocks::instance->GetVictoryAchievement(x.name);
-                    }
+static Point GetShipButtonPosition(int onPage)
+{
+    if (onPage < 4)
+    {
+        return Point(136 + 205 * onPage, 161);
+    }
+    else if (onPage < 8)
+    {
+        return Point(136 + 205 * 3 - 205 * (onPage - 4), 161 + 177);
+    }
+    else if (onPage == 8)
+    {
+        return Point(136 + 205 * 3 + 225, 161);
+    }
+    else if (onPage == 9)
+    {
+        return Point(136 + 205 * 3 + 225, 161 + 177);
+    }
+    return Point(0, 0);
+}
 
-                    if (x.splitUnlockQuestAchievement)
-                    {
-                        if (CustomShipUnlocks::instance->CustomShipHasUnlockQuest(finalName))
-                        {
-                            buttons[variant]->achievements[4] = CustomShipUnlocks::instance->GetQuestAchievement(finalName);
-                        }
-                    }
-                    else
-                    {
-                        if (CustomShipUnlocks::instance->CustomShipHasUnlockQuestAnyLayout(x.name))
-                        {
-                            buttons[variant]->achievements[4] = CustomShipUnlocks::instance->GetQuestAchievement(x.name);
-                        }
-                    }
+void CustomShipSelect::LoadShipPage(int page)
+{
+    if (page < 0 || page >= (int)shipButtonPages.size())
+        return;
 
-                    while (!buttons[variant]->achievements.empty() && buttons[variant]->achievements.back() == nullptr) buttons[variant]->achievements.pop_back();
-                    buttons[variant]->achievements.shrink_to_fit();
-                }
+    auto it = std::find(loadedShipPages.begin(), loadedShipPages.end(), page);
+    if (it != loadedShipPages.end())
+    {
+        loadedShipPages.splice(loadedShipPages.begin(), loadedShipPages, it);
+        return;
+    }
+
+    for (ShipButtonList* buttonList : shipButtonPages[page])
+    {
+        ShipButtonDefinition &x = shipButtonDefs[buttonList->GetIndex()];
+
+        // create and initialize ShipButtons for each of the blueprints
+        ShipButton* buttons[3];
 
-//                if (!(buttons[variant]->bNoExist || buttons[variant]->bShipLocked))
-//                    pos.y = oldY + 20;
-//                else
-//                    pos.y = oldY;
+        for (int variant = 0; variant < 3; ++variant)
+        {
+            buttons[variant] = new ShipButton(buttonList->GetId(), variant);
 
-                buttons[variant]->OnInit("customizeUI/ship_list_button", pos);
+            if (!x.VariantExists(variant))
+            {
+                buttons[variant]->bNoExist = true;
+                buttons[variant]->bActive = false;
             }
         }
-    }
-    else
-    {
-        int i = 0;
-        for (auto x : shipButtons)
-        {
-            std::string shipName = GetShipBlueprint(x->GetId());
 
-            ShipButton *aButton = x->GetButton(0);
-            ShipButton *bButton = x->GetButton(1);
-            ShipButton *cButton = x->GetButton(2);
+        buttonList->SetButtons(buttons[0], buttons[1], buttons[2]);
 
-            if (!aButton->bNoExist)
+        Point pos = GetShipButtonPosition(buttonList->GetSlot());
+
+        for (int variant = 0; variant < 3; ++variant)
+        {
+            if (x.VariantExists(variant))
             {
-                if (CustomShipUnlocks::instance->CustomShipHasUnlock(shipName))
+                std::string finalName = GetVariantName(x.name, variant);
+
+                buttons[variant]->achievements.resize(5, nullptr);
+
+                if (CustomShipUnlocks::instance->CustomShipHasUnlock(finalName))
                 {
-                    aButton->bShipLocked = !CustomShipUnlocks::instance->GetCustomShipUnlocked(shipName);
-                    aButton->bLayoutLocked = aButton->bShipLocked;
-                    if (aButton->bShipLocked && aButton->hitbox.h > 140)
-                    {
-                        aButton->hitbox.h -= 40;
-                        aButton->SetLocation({aButton->position.x, aButton->position.y + 20});
-                    }
-                    else if (!aButton->bShipLocked && aButton->hitbox.h < 140)
-                    {
-                        aButton->hitbox.h += 40;
-                        aButton->SetLocation({aButton->position.x, aButton->position.y - 20});
-                    }
+                    buttons[variant]->bShipLocked = !CustomShipUnlocks::instance->GetCustomShipUnlocked(finalName);
+                    buttons[variant]->bLayoutLocked = buttons[variant]->bShipLocked;
                 }
-            }
-            if (!bButton->bNoExist)
-            {
-                if (CustomShipUnlocks::instance->CustomShipHasUnlock(shipName + "_2"))
+
+                if (x.splitVictoryAchievement)
                 {
-                    bButton->bShipLocked = !CustomShipUnlocks::instance->GetCustomShipUnlocked(shipName + "_2");
-                    bButton->bLayoutLocked = bButton->bShipLocked;
-                    if (bButton->bShipLocked && bButton->hitbox.h > 140)
-                    {
-                        bButton->hitbox.h -= 40;
-                        bButton->SetLocation({bButton->position.x, bButton->position.y + 20});
-                    }
-                    else if (!bButton->bShipLocked && bButton->hitbox.h < 140)
-                    {
-                        bButton->hitbox.h += 40;
-                        bButton->SetLocation({bButton->position.x, bButton->position.y - 20});
-                    }
+                    buttons[variant]->achievements[3] = CustomShipUnlocks::instance->GetVictoryAchievement(finalName);
                 }
-            }
-            if (!cButton->bNoExist)
-            {
-                if (CustomShipUnlocks::instance->CustomShipHasUnlock(shipName + "_3"))
+                else
+                {
+                    buttons[variant]->achievements[3] = CustomShipUnlocks::instance->GetVictoryAchievement(x.name);
+                }
+
+                if (x.splitUnlockQuestAchievement)
                 {
-                    cButton->bShipLocked = !CustomShipUnlocks::instance->GetCustomShipUnlocked(shipName + "_3");
-                    cButton->bLayoutLocked = cButton->bShipLocked;
-                    if (cButton->bShipLocked && cButton->hitbox.h > 140)
+                    if (CustomShipUnlocks::instance->CustomShipHasUnlockQuest(finalName))
                     {
-                        cButton->hitbox.h -= 40;
-                        cButton->SetLocation({cButton->position.x, cButton->position.y + 20});
+                        buttons[variant]->achievements[4] = CustomShipUnlocks::instance->GetQuestAchievement(finalName);
                     }
-                    else if (!cButton->bShipLocked && cButton->hitbox.h < 140)
+                }
+                else
+                {
+                    if (CustomShipUnlocks::instance->CustomShipHasUnlockQuestAnyLayout(x.name))
                     {
-                        cButton->hitbox.h += 40;
-                        cButton->SetLocation({cButton->position.x, cButton->position.y - 20});
+                        buttons[variant]->achievements[4] = CustomShipUnlocks::instance->GetQuestAchievement(x.name);
                     }
                 }
+
+                while (!buttons[variant]->achievements.empty() && buttons[variant]->achievements.back() == nullptr) buttons[variant]->achievements.pop_back();
+                buttons[variant]->achievements.shrink_to_fit();
             }
-        }
-    }
 
+            buttons[variant]->OnInit("customizeUI/ship_list_button", pos);
+        }
 
+        UpdateButtonAchievements(buttonList);
+    }
 
+    loadedShipPages.push_front(page);
 
-    std::string buttonImg("customizeUI/button_ship_arrow");
-    leftButton = new Button();
-    leftButton->OnInit(buttonImg, Point(1100, 119));
+    // Keep only a few recently visited pages around, the rest get rebuilt when visited again
+    while (loadedShipPages.size() > maxLoadedShipPages)
+    {
+        UnloadShipPage(loadedShipPages.back());
+    }
+}
 
-    rightButton = new Button();
-    rightButton->OnInit(buttonImg, Point(1135, 119));
+void CustomShipSelect::UnloadShipPage(int page)
+{
+    auto it = std::find(loadedShipPages.begin(), loadedShipPages.end(), page);
+    if (it == loadedShipPages.end())
+        return;
 
-    rightButton->bMirror = true;
+    loadedShipPages.erase(it);
 
-    if (maxShipPage == 0 || (maxShipPage == 1 && hideFirstPage))
+    for (ShipButtonList* buttonList : shipButtonPages[page])
     {
-        leftButton->bActive = false;
-        rightButton->bActive = false;
+        buttonList->Unload();
     }
+}
 
+const std::vector<ShipButtonList*>& CustomShipSelect::GetPageButtons(int page)
+{
+    static const std::vector<ShipButtonList*> noButtons;
 
-    shipSelect = shipSelect_;
-    oldShipButtons = shipSelect->shipButtons;
+    if (page < 0 || page >= (int)shipButtonPages.size())
+        return noButtons;
 
-    UpdateFilteredAchievements();
+    return shipButtonPages[page];
+}
 
-    initialized = true;
+void CustomShipSelect::UpdateButtonLocks(ShipButtonList* buttonList)
+{
+    if (!buttonList->IsLoaded())
+        return;
+
+    std::string shipName = GetShipBlueprint(buttonList->GetId());
+
+    for (int variant = 0; variant < 3; ++variant)
+    {
+        ShipButton *button = buttonList->GetButton(variant);
+        std::string finalName = GetVariantName(shipName, variant);
+
+        if (!button->bNoExist)
+        {
+            if (CustomShipUnlocks::instance->CustomShipHasUnlock(finalName))
+            {
+                button->bShipLocked = !CustomShipUnlocks::instance->GetCustomShipUnlocked(finalName);
+                button->bLayoutLocked = button->bShipLocked;
+                if (button->bShipLocked && button->hitbox.h > 140)
+                {
+                    button->hitbox.h -= 40;
+                    button->SetLocation({button->position.x, button->position.y + 20});
+                }
+                else if (!button->bShipLocked && button->hitbox.h < 140)
+                {
+                    button->hitbox.h += 40;
+                    button->SetLocation({button->position.x, button->position.y - 20});
+                }
+            }
+        }
+    }
 }
 
 void CustomShipSelect::UpdateFilteredAchievements()
 {
     CustomShipUnlocks *customUnlocks = CustomShipUnlocks::instance;
 
-    std::vector<std::string> victoryTypes;
+    std::vector<CustomVictoryAchievement*> &victoryTypes = filteredVictories;
+    victoryTypes.clear();
     for (std::string &i : shipVictoryFilters)
     {
-        if (!customUnlocks->customVictories[i].secret || !customUnlocks->customVictories[i].SecretLocked())
+        CustomVictoryAchievement *victory = &customUnlocks->customVictories[i];
+        if (!victory->secret || !victory->SecretLocked())
         {
-            victoryTypes.push_back(i);
+            victoryTypes.push_back(victory);
         }
     }
     if (victoryTypes.size() > 3) victoryTypes.resize(3);
@@ -1052,9 +1115,9 @@ void CustomShipSelect::UpdateFilteredAchievements()
             {
                 CAchievement *ach = dummyAchievement; // because nullptr will crash
 
-                if (i < victoryTypes.size())
+                if (i < (int)victoryTypes.size())
                 {
-                    ach = CustomShipUnlocks::instance->customVictories[victoryTypes[i]].GetVictoryAchievement(shipName);
+                    ach = victoryTypes[i]->GetVictoryAchievement(shipName);
                 }
 
                 if (button->achievements.size() > i)
@@ -1071,76 +1134,89 @@ void CustomShipSelect::UpdateFilteredAchievements()
         counter = counter + 1;
     }
 
-    for (auto x : shipButtons)
+    for (int page : loadedShipPages)
     {
-        std::string shipName = GetShipBlueprint(x->GetId());
+        for (ShipButtonList* x : shipButtonPages[page])
+        {
+            UpdateButtonAchievements(x);
+        }
+    }
+}
+
+void CustomShipSelect::UpdateButtonAchievements(ShipButtonList* buttonList)
+{
+    if (!buttonList->IsLoaded())
+        return;
 
-        int shipId = GetShipButtonIdFromName(shipName);
+    const std::vector<CustomVictoryAchievement*> &victoryTypes = filteredVictories;
 
-        if (shipId == -1)
-            continue;
+    std::string shipName = GetShipBlueprint(buttonList->GetId());
 
-        ShipButtonDefinition &buttonDef = shipButtonDefs[shipId];
+    int shipId = GetShipButtonIdFromName(shipName);
+
+    if (shipId == -1)
+        return;
 
-        for (auto variant=0; variant<3; ++variant)
+    ShipButtonDefinition &buttonDef = shipButtonDefs[shipId];
+
+    for (auto variant=0; variant<3; ++variant)
+    {
+        ShipButton *button = buttonList->GetButton(variant);
+
+        if (!button->bNoExist)
         {
-            ShipButton *button = x->GetButton(variant);
+            std::string finalName = GetVariantName(shipName, variant);
 
-            if (!button->bNoExist)
+            if (victoryTypes.empty())
             {
-                std::string finalName = GetVariantName(shipName, variant);
-
-                if (victoryTypes.empty())
+                std::vector<CAchievement*> customShipAchievements = CustomAchievementTracker::instance->GetShipAchievementsCustom(shipName, variant, false);
+                for (auto i=0; i<3; ++i)
                 {
-                    std::vector<CAchievement*> customShipAchievements = CustomAchievementTracker::instance->GetShipAchievementsCustom(shipName, variant, false);
-                    for (auto i=0; i<3; ++i)
+                    CAchievement *ach = nullptr;
+                    if (i < buttonDef.shipAchievements[variant].size())
                     {
-                        CAchievement *ach = nullptr;
-                        if (i < buttonDef.shipAchievements[variant].size())
-                        {
-                           ach = customShipAchievements[i];
-                           ach->miniIcon.SetImagePath(boost::str(boost::format("achievements/S_%1d_on.png") % (i+1)));
-                           ach->miniIconLocked.SetImagePath(boost::str(boost::format("achievements/S_%1d_off.png") % (i+1)));
-                        }
-                        if (button->achievements.size() > i)
-                        {
-                            button->achievements[i] = ach;
-                        }
-                        else
-                        {
-                            button->achievements.push_back(ach);
-                        }
+                       ach = customShipAchievements[i];
+                       ach->miniIcon.SetImagePath(boost::str(boost::format("achievements/S_%1d_on.png") % (i+1)));
+                       ach->miniIconLocked.SetImagePath(boost::str(boost::format("achievements/S_%1d_off.png") % (i+1)));
+                    }
+                    if (button->achievements.size() > i)
+                    {
+                        button->achievements[i] = ach;
+                    }
+                    else
+                    {
+                        button->achievements.push_back(ach);
                     }
                 }
-                else
+            }
+            else
+            {
+                for (auto i=0; i<3; ++i)
                 {
-                    for (auto i=0; i<3; ++i)
-                    {
-                        CAchievement *ach = nullptr;
+                    CAchievement *ach = nullptr;
 
-                        if (i < victoryTypes.size())
-                        {
-                            CustomVictoryAchievement &victoryAch = CustomShipUnlocks::instance->customVictories[victoryTypes[i]];
-
-                            if (buttonDef.splitVictoryAchievement)
-                            {
-                                ach = victoryAch.GetVictoryAchievement(finalName);
-                            }
-                            else
-                            {
-                                ach = victoryAch.GetVictoryAchievement(shipName);
-                            }
-                        }
+                    if (i < (int)victoryTypes.size())
+                    {
+                        CustomVictoryAchievement &victoryAch = *victoryTypes[i];
 
-                        if (button->achievements.size() > i)
+                        if (buttonDef.splitVictoryAchievement)
                         {
-                            button->achievements[i] = ach;
+                            ach = victoryAch.GetVictoryAchievement(finalName);
                         }
                         else
                         {
-                            button->achievements.push_back(ach);
+                            ach = victoryAch.GetVictoryAchievement(shipName);
                         }
                     }
+
+                    if (button->achievements.size() > i)
+                    {
+                        button->achievements[i] = ach;
+                    }
+                    else
+                    {
+                        button->achievements.push_back(ach);
+                    }
                 }
             }
         }
@@ -1167,65 +1243,59 @@ void CustomShipSelect::OnRender(bool renderSelect)
 
     if (renderSelect)
     {
-        for (auto const &x: shipButtons)
+        for (auto const &x: GetPageButtons(shipPage - 1))
         {
-            if (x->GetPage() == shipPage - 1)
+            std::string shipName = GetShipBlueprint(x->GetId());
+            ShipButton* button = x->GetButton(shipSelect->currentType);
+            if (shipSelect->currentType == 1)
             {
-                std::string shipName = GetShipBlueprint(x->GetId());
-                ShipButton* button = x->GetButton(shipSelect->currentType);
-                if (shipSelect->currentType == 1)
-                {
-                    shipName += "_2";
-                }
-                else if (shipSelect->currentType == 2)
-                {
-                    shipName += "_3";
-                }
+                shipName += "_2";
+            }
+            else if (shipSelect->currentType == 2)
+            {
+                shipName += "_3";
+            }
 
-                // Set locked miniship image to the version with the "_base" postfix if it exists
-                if (button)
-                {
-                    auto bp = G_->GetBlueprints()->GetShipBlueprint(shipName, -1);
-                    std::string lockImgName = "customizeUI/miniship_" + bp->imgFile + "_base.png";
-                    bool useLockImg = CustomOptionsManager::GetInstance()->altLockedMiniships.currentValue && button->bShipLocked && G_->GetResources()->ImageExists(lockImgName);
-                    button->iShipImage = G_->GetResources()->GetImageId(useLockImg ? lockImgName : "customizeUI/miniship_" + bp->imgFile + ".png");
-                    button->OnRender();
-                }
+            // Set locked miniship image to the version with the "_base" postfix if it exists
+            if (button)
+            {
+                auto bp = G_->GetBlueprints()->GetShipBlueprint(shipName, -1);
+                std::string lockImgName = "customizeUI/miniship_" + bp->imgFile + "_base.png";
+                bool useLockImg = CustomOptionsManager::GetInstance()->altLockedMiniships.currentValue && button->bShipLocked && G_->GetResources()->ImageExists(lockImgName);
+                button->iShipImage = G_->GetResources()->GetImageId(useLockImg ? lockImgName : "customizeUI/miniship_" + bp->imgFile + ".png");
+                button->OnRender();
             }
         }
         if (shipPage > 0)
         {
-            for (auto const &x: shipButtons)
+            for (auto const &x: GetPageButtons(shipPage - 1))
             {
-                if (x->GetPage() == shipPage - 1)
-                {
-                    ShipButton* button = x->GetButton(shipSelect->currentType);
+                ShipButton* button = x->GetButton(shipSelect->currentType);
 
-                    if (button)
+                if (button)
+                {
+                    ShipButtonDefinition* def = &GetShipButtonDefinition(x->GetIndex());
+                    if (def && def->VariantExists(shipSelect->currentType))
                     {
-                        ShipButtonDefinition* def = &GetShipButtonDefinition(x->GetIndex());
-                        if (def && def->VariantExists(shipSelect->currentType))
+                        for (CustomUnlockArrow &arrow : def->unlockArrows)
                         {
-                            for (CustomUnlockArrow &arrow : def->unlockArrows)
+                            if (arrow.variant == shipSelect->currentType || arrow.variant == -1)
                             {
-                                if (arrow.variant == shipSelect->currentType || arrow.variant == -1)
+                                if (!CustomShipUnlocks::instance->GetCustomShipUnlocked(arrow.targetShip))
                                 {
-                                    if (!CustomShipUnlocks::instance->GetCustomShipUnlocked(arrow.targetShip))
+                                    if (button->bShipLocked)
                                     {
-                                        if (button->bShipLocked)
-                                        {
-                                            arrow.OnRender(button->position.x, button->position.y, 0);
-                                        }
-                                        else
-                                        {
-                                            arrow.OnRender(button->position.x, button->position.y, 1);
-                                        }
+                                        arrow.OnRender(button->position.x, button->position.y, 0);
                                     }
-                                    else if (arrow.image[2] != nullptr)
+                                    else
                                     {
-                                        arrow.OnRender(button->position.x, button->position.y, 2);
+                                        arrow.OnRender(button->position.x, button->position.y, 1);
                                     }
                                 }
+                                else if (arrow.image[2] != nullptr)
+                                {
+                                    arrow.OnRender(button->position.x, button->position.y, 2);
+                                }
                             }
                         }
                     }
@@ -1438,6 +1508,10 @@ void CustomShipSelect::SwitchPage(int page)
     {
         EnterFirstPage();
     }
+    else
+    {
+        LoadShipPage(page - 1);
+    }
 
     shipPage = page;
 }
@@ -1537,26 +1611,23 @@ void CustomShipSelect::MouseMove(int x, int y)
     selectedShip = -1;
     int lockedSelectedShip = -1;
 
-    for (auto const &i: shipButtons)
+    for (auto const &i: GetPageButtons(shipPage - 1))
     {
-        if (i->GetPage() == shipPage - 1)
-        {
-            ShipButton* button = i->GetButton(shipSelect->currentType);
+        ShipButton* button = i->GetButton(shipSelect->currentType);
 
-            if (button)
+        if (button)
+        {
+            button->MouseMove(x, y);
+            if (button->bHover && button->bActive)
             {
-                button->MouseMove(x, y);
-                if (button->bHover && button->bActive)
+                if (button->bLayoutLocked)
                 {
-                    if (button->bLayoutLocked)
-                    {
-                        lockedSelectedShip = i->GetIndex();
-                    }
-                    else
-                    {
-                        selectedShip = i->GetIndex();
-                        lastSelectedShip = selectedShip;
-                    }
+                    lockedSelectedShip = i->GetIndex();
+                }
+                else
+                {
+                    selectedShip = i->GetIndex();
+                    lastSelectedShip = selectedShip;
                 }
             }
         }
@@ -1564,37 +1635,34 @@ void CustomShipSelect::MouseMove(int x, int y)
 
     if (shipPage > 0)
     {
-        for (auto const &buttons: shipButtons)
+        for (auto const &buttons: GetPageButtons(shipPage - 1))
         {
-            if (buttons->GetPage() == shipPage - 1)
-            {
-                ShipButton* button = buttons->GetButton(shipSelect->currentType);
+            ShipButton* button = buttons->GetButton(shipSelect->currentType);
 
-                if (button)
+            if (button)
+            {
+                ShipButtonDefinition* def = &GetShipButtonDefinition(buttons->GetIndex());
+                if (def && def->VariantExists(shipSelect->currentType))
                 {
-                    ShipButtonDefinition* def = &GetShipButtonDefinition(buttons->GetIndex());
-                    if (def && def->VariantExists(shipSelect->currentType))
+                    for (CustomUnlockArrow &arrow : def->unlockArrows)
                     {
-                        for (CustomUnlockArrow &arrow : def->unlockArrows)
+                        if (arrow.variant == shipSelect->currentType || arrow.variant == -1)
                         {
-                            if (arrow.variant == shipSelect->currentType || arrow.variant == -1)
+                            if (!CustomShipUnlocks::instance->GetCustomShipUnlocked(arrow.targetShip))
                             {
-                                if (!CustomShipUnlocks::instance->GetCustomShipUnlocked(arrow.targetShip))
+                                if (button->bShipLocked)
                                 {
-                                    if (button->bShipLocked)
-                                    {
-                                        arrow.MouseMove(x - button->position.x, y - button->position.y, 0);
-                                    }
-                                    else
-                                    {
-                                        arrow.MouseMove(x - button->position.x, y - button->position.y, 1);
-                                    }
+                                    arrow.MouseMove(x - button->position.x, y - button->position.y, 0);
                                 }
-                                else if (arrow.image[2] != nullptr)
+                                else
                                 {
-                                    arrow.MouseMove(x - button->position.x, y - button->position.y, 2);
+                                    arrow.MouseMove(x - button->position.x, y - button->position.y, 1);
                                 }
                             }
+                            else if (arrow.image[2] != nullptr)
+                            {
+                                arrow.MouseMove(x - button->position.x, y - button->position.y, 2);
+                            }
                         }
                     }
                 }
@@ -1865,9 +1933,9 @@ int CustomShipSelect::CycleShipNext(int currentShipId, int currentType)
     int counter = 0;
     while (true)
     {
-        ShipButtonDefinition* def = GetOrderedShipButtonDefinition(index);
+        int shipId = GetOrderedShipButtonId(index);
 
-        if (!def || !def->VariantExists(currentType) || !CustomShipUnlocks::instance->GetCustomShipUnlocked(def->name, currentType))
+        if (shipId == -1 || !shipButtonDefs[shipId].VariantExists(currentType) || !CustomShipUnlocks::instance->GetShipIdUnlocked(shipId + 100, currentType))
         {
             if (index + 1 >= numShips)
             {
@@ -1887,7 +1955,7 @@ int CustomShipSelect::CycleShipNext(int currentShipId, int currentType)
         }
         else
         {
-            index = GetShipButtonIdFromName(def->name);
+            index = shipId;
             break;
         }
     }
@@ -1914,9 +1982,9 @@ int CustomShipSelect::CycleShipPrevious(int currentShipId, int currentType)
     int counter = 0;
     while (true)
     {
-        ShipButtonDefinition* def = GetOrderedShipButtonDefinition(index);
+        int shipId = GetOrderedShipButtonId(index);
 
-        if (!def || !def->VariantExists(currentType) || !CustomShipUnlocks::instance->GetCustomShipUnlocked(def->name, currentType))
+        if (shipId == -1 || !shipButtonDefs[shipId].VariantExists(currentType) || !CustomShipUnlocks::instance->GetShipIdUnlocked(shipId + 100, currentType))
         {
             if (index <= 0)
             {
@@ -1936,7 +2004,7 @@ int CustomShipSelect::CycleShipPrevious(int currentShipId, int currentType)
         }
         else
         {
-            index = GetShipButtonIdFromName(def->name);
+            index = shipId;
 
             break;
         }
@@ -1956,13 +2024,13 @@ int CustomShipSelect::CountUnlockedShips(int variant=-1)
 
     for (int i = 0; i < (customShipOrder.size()); i++)
     {
-        ShipButtonDefinition* def = GetOrderedShipButtonDefinition(i);
-
         if (variant != -1)
         {
-            if (def && CustomShipUnlocks::instance->GetCustomShipUnlocked(def->name, variant))
+            int shipId = GetOrderedShipButtonId(i);
+
+            if (shipId != -1 && CustomShipUnlocks::instance->GetShipIdUnlocked(shipId + 100, variant))
             {
-                if (def->VariantExists(variant))
+                if (shipButtonDefs[shipId].VariantExists(variant))
                 {
                     counter++;
                 }
@@ -2796,7 +2864,7 @@ HOOK_METHOD_PRIORITY(ShipBuilder, OnRender, 1000, () -> void)
         reactorInfoButton->OnRender();
         std::string reactorImagePath = "icons/s_reactor_green1.png";
         G_->GetResources()->RenderImageString(reactorImagePath, reactorInfoPos.x-13, reactorInfoPos.y+45, 0, {1.f,1.f,1.f,1.f}, 1.f, false);
-        auto def = CustomShipSelect::GetInstance()->GetDefinition(currentShip->myBlueprint.blueprintName);
+        const CustomShipDefinition &def = CustomShipSelect::GetInstance()->GetDefinition(currentShip->myBlueprint.blueprintName);
         CSurface::GL_SetColor(GL_Color(100.0/255, 1, 100.0/255, 1));
         freetype::easy_printCenter(52, reactorInfoPos.x+18, reactorInfoPos.y+25, std::to_string(PowerManager::GetPowerManager(0)->currentPower.second));
         freetype::easy_printCenter(52, reactorInfoPos.x+18, reactorInfoPos.y+43, std::to_string(def.maxReactorLevel));
@@ -2982,7 +3050,7 @@ HOOK_METHOD(ShipBuilder, MouseMove, (int x, int y) -> void)
         reactorInfoButton->MouseMove(x,y,false);
         if (reactorInfoButton->bHover)
         {
-            auto def = CustomShipSelect::GetInstance()->GetDefinition(currentShip->myBlueprint.blueprintName);
+            const CustomShipDefinition &def = CustomShipSelect::GetInstance()->GetDefinition(currentShip->myBlueprint.blueprintName);
             std::string reactorDescText = G_->GetTextLibrary()->GetText("reactor_desc") + "\n\n" +
                                           boost::algorithm::replace_all_copy(G_->GetTextLibrary()->GetText("reactor_desc_start"), "\\1", std::to_string(PowerManager::GetPowerManager(0)->currentPower.second)) + "\n" +
                                           boost::algorithm::replace_all_copy(G_->GetTextLibrary()->GetText("reactor_desc_max"), "\\1", std::to_string(def.maxReactorLevel));
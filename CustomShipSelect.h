@@ -4,9 +4,12 @@
 #include "Room_Extend.h"
 #include "CustomAchievements.h"
 #include <array>
+#include <list>
 #include <algorithm>
 #include <boost/algorithm/string/predicate.hpp>
 
+struct CustomVictoryAchievement;
+
 struct CustomUnlockArrow
 {
     std::string ship = "";
@@ -113,12 +116,13 @@ struct CustomShipDefinition
 class ShipButtonList
 {
 public:
-    ShipButtonList(int _page, int _id, ShipButton* _a, ShipButton* _b=NULL, ShipButton* _c=nullptr)
+    ShipButtonList(int _page, int _slot, int _id)
     : page(_page),
+      slot(_slot),
       id(_id),
-      a(_a),
-      b(_b),
-      c(_c)
+      a(nullptr),
+      b(nullptr),
+      c(nullptr)
     {
 
     }
@@ -131,11 +135,39 @@ public:
         return nullptr;
     }
 
+    void SetButtons(ShipButton* _a, ShipButton* _b, ShipButton* _c)
+    {
+        a = _a;
+        b = _b;
+        c = _c;
+    }
+
+    // Buttons are only created while their page is loaded, see CustomShipSelect::LoadShipPage
+    bool IsLoaded()
+    {
+        return a != nullptr;
+    }
+
+    void Unload()
+    {
+        delete a;
+        delete b;
+        delete c;
+        a = nullptr;
+        b = nullptr;
+        c = nullptr;
+    }
+
     int GetPage()
     {
         return page;
     }
 
+    int GetSlot()
+    {
+        return slot;
+    }
+
     int GetId()
     {
         return id;
@@ -148,6 +180,7 @@ public:
 
 private:
     int page;
+    int slot;
     int id;
     ShipButton* a;
     ShipButton* b;
@@ -209,6 +242,8 @@ public:
     int CountUnlockedShips(int variant);
 
     void UpdateFilteredAchievements();
+    void LoadShipPage(int page);
+    void UnloadShipPage(int page);
     
     bool ShowAchievementsForShip(int currentShipId, int currentType);
 
@@ -283,12 +318,10 @@ public:
 
     ShipButtonList* GetShipButtonListFromID(int id)
     {
-        for (auto& def : shipButtons)
+        auto it = shipButtonIds.find(id);
+        if (it != shipButtonIds.end())
         {
-            if (def->GetId() == id) 
-            {
-                return def;
-            }
+            return it->second;
         }
         return nullptr;
     }
@@ -331,15 +364,22 @@ public:
 
     ShipButtonDefinition* GetOrderedShipButtonDefinition(int id)
     {
-        if (id > customShipOrder.size()) return nullptr;
-
-        id = GetShipButtonIdFromName(customShipOrder[id]);
+        id = GetOrderedShipButtonId(id);
 
         if (id == -1) return nullptr;
 
         return &shipButtonDefs[id];
     }
 
+    int GetOrderedShipButtonId(int id)
+    {
+        if (id < 0 || id >= (int)customShipOrder.size()) return -1;
+
+        if (id < (int)customShipOrderIds.size()) return customShipOrderIds[id];
+
+        return GetShipButtonIdFromName(customShipOrder[id]);
+    }
+
     int GetShipButtonOrderIndex(int id)
     {
         auto name = shipButtonDefs[id].name;
@@ -412,6 +452,7 @@ public:
     }
 
     std::vector<std::string> customShipOrder = std::vector<std::string>();
+    std::vector<int> customShipOrderIds = std::vector<int>(); // button ids of customShipOrder, filled once the order is final
     bool hideFirstPage;
 
     bool showShipAchievements = false;
@@ -429,6 +470,15 @@ private:
 
     std::vector<ShipButton*> oldShipButtons;
     std::vector<ShipButtonList*> shipButtons = std::vector<ShipButtonList*>();
+    std::vector<std::vector<ShipButtonList*>> shipButtonPages = std::vector<std::vector<ShipButtonList*>>();
+    std::unordered_map<int, ShipButtonList*> shipButtonIds = std::unordered_map<int, ShipButtonList*>();
+    std::list<int> loadedShipPages = std::list<int>(); // most recently visited first
+    static const int maxLoadedShipPages = 4;
+    std::vector<CustomVictoryAchievement*> filteredVictories = std::vector<CustomVictoryAchievement*>();
+
+    const std::vector<ShipButtonList*>& GetPageButtons(int page);
+    void UpdateButtonLocks(ShipButtonList* buttonList);
+    void UpdateButtonAchievements(ShipButtonList* buttonList);
     std::vector<ShipButtonDefinition> shipButtonDefs = std::vector<ShipButtonDefinition> ();
     std::unordered_map<std::string, CustomShipDefinition> shipDefs = std::unordered_map<std::string, CustomShipDefinition>();
 
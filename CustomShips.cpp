@@ -2,8 +2,8 @@
 #include "CustomShips.h"
 #include "CustomShipSelect.h"
 #include "EnemyShipIcons.h"
+#include "XMLValue.h"
 
-#include <boost/lexical_cast.hpp>
 
 static bool importingShip = false;
 bool revisitingShip = false;
@@ -75,11 +75,11 @@ void ShipManager_Extend::Initialize(bool restarting)
 
             if (i.isList)
             {
-                std::vector<std::string> bpList = G_->GetBlueprints()->GetBlueprintList(i.species);
+                const std::vector<std::string> *bpList = BlueprintListRegistry::GetList(i.species);
 
-                if (!bpList.empty())
+                if (bpList && !bpList->empty())
                 {
-                    species = bpList[rand() % bpList.size()];
+                    species = (*bpList)[rand() % bpList->size()];
                 }
                 else
                 {
@@ -117,7 +117,7 @@ HOOK_METHOD(ShipManager, ResetScrapLevel, () -> void)
     super();
     auto customSel = CustomShipSelect::GetInstance();
 
-    auto def = customSel->GetDefinition(myBlueprint.blueprintName);
+    const CustomShipDefinition &def = customSel->GetDefinition(myBlueprint.blueprintName);
     if (def.startingScrap != -1)
     {
         currentScrap = def.startingScrap;
@@ -1276,11 +1276,11 @@ HOOK_METHOD(Ship, OnInit, (ShipBlueprint* bp) -> void)
                         bool mirror = false;
                         if (child->first_attribute("x"))
                         {
-                            pos.x = boost::lexical_cast<float>(child->first_attribute("x")->value());
+                            pos.x = XMLValue::Attribute<float>(child, "x");
                         }
                         if (child->first_attribute("y"))
                         {
-                            pos.y = boost::lexical_cast<float>(child->first_attribute("y")->value());
+                            pos.y = XMLValue::Attribute<float>(child, "y");
                         }
                         if (child->first_attribute("rotate"))
                         {
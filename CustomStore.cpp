@@ -2,7 +2,7 @@
 #include "CustomEvents.h"
 #include "CustomShipSelect.h"
 #include "Store_Extend.h"
-#include <boost/lexical_cast.hpp>
+#include "XMLValue.h"
 #include <array>
 
 CustomStore* CustomStore::instance = new CustomStore();
@@ -19,14 +19,13 @@ static ItemPrice ParsePriceNode(rapidxml::xml_node<char>* node)
     for (auto cNode = node->first_node(); cNode; cNode = cNode->next_sibling())
     {
         std::string name = cNode->name();
-        std::string val = cNode->value();
 
         if (name == "price")
         {
             if (cNode->first_attribute("min") && cNode->first_attribute("max"))
             {
-                def.minMaxPrice.first = boost::lexical_cast<float>(cNode->first_attribute("min")->value());
-                def.minMaxPrice.second = boost::lexical_cast<float>(cNode->first_attribute("max")->value());
+                def.minMaxPrice.first = XMLValue::Attribute<float>(cNode, "min");
+                def.minMaxPrice.second = XMLValue::Attribute<float>(cNode, "max");
                 def.useMinMax = true;
 
                 if (def.minMaxPrice.first > def.minMaxPrice.second)
@@ -35,9 +34,9 @@ static ItemPrice ParsePriceNode(rapidxml::xml_node<char>* node)
                 }
             }
 
-            if (!val.empty())
+            if (cNode->value_size() != 0)
             {
-                def.price = boost::lexical_cast<int>(val);
+                def.price = XMLValue::Value<int>(cNode);
             }
         }
         if (name == "sectorScaled")
@@ -48,8 +47,8 @@ static ItemPrice ParsePriceNode(rapidxml::xml_node<char>* node)
         {
             if (cNode->first_attribute("min") && cNode->first_attribute("max"))
             {
-                def.minMaxModifier.first = boost::lexical_cast<float>(cNode->first_attribute("min")->value());
-                def.minMaxModifier.second = boost::lexical_cast<float>(cNode->first_attribute("max")->value());
+                def.minMaxModifier.first = XMLValue::Attribute<float>(cNode, "min");
+                def.minMaxModifier.second = XMLValue::Attribute<float>(cNode, "max");
 
                 if (def.minMaxModifier.first > def.minMaxModifier.second)
                 {
@@ -62,10 +61,10 @@ static ItemPrice ParsePriceNode(rapidxml::xml_node<char>* node)
                 def.flatModifier = EventsParser::ParseBoolean(cNode->first_attribute("flat")->value());
             }
 
-            if (!val.empty())
+            if (cNode->value_size() != 0)
             {
-                def.minMaxModifier.first = boost::lexical_cast<float>(val);
-                def.minMaxModifier.second = boost::lexical_cast<float>(val);
+                def.minMaxModifier.first = XMLValue::Value<float>(cNode);
+                def.minMaxModifier.second = XMLValue::Value<float>(cNode);
             }
 
             def.hasModifier = true;
@@ -83,7 +82,6 @@ static HullRepair ParseHullRepairNode(rapidxml::xml_node<char>* node)
     for (auto cNode = node->first_node(); cNode; cNode = cNode->next_sibling())
     {
         std::string name = cNode->name();
-        std::string val = cNode->value();
     }
 
     return def;
@@ -107,14 +105,14 @@ static ResourceItem ParseResourceNode(rapidxml::xml_node<char>* node)
         {
             if (cNode->first_attribute("min") && cNode->first_attribute("max"))
             {
-                def.minMaxCount.first = boost::lexical_cast<int>(cNode->first_attribute("min")->value());
-                def.minMaxCount.second = boost::lexical_cast<int>(cNode->first_attribute("max")->value());
+                def.minMaxCount.first = XMLValue::Attribute<int>(cNode, "min");
+                def.minMaxCount.second = XMLValue::Attribute<int>(cNode, "max");
             }
 
             if (!val.empty())
             {
-                def.minMaxCount.first = boost::lexical_cast<int>(val);
-                def.minMaxCount.second = boost::lexical_cast<int>(val);
+                def.minMaxCount.first = XMLValue::Value<int>(cNode);
+                def.minMaxCount.second = XMLValue::Value<int>(cNode);
             }
         }
     }
@@ -177,11 +175,11 @@ static StoreCategory ParseCategoryNode(rapidxml::xml_node<char>* node)
         }
         if (name == "chance")
         {
-            def.chance = boost::lexical_cast<int>(val);
+            def.chance = XMLValue::Value<int>(cNode);
         }
         if (name == "groupChance")
         {
-            def.groupChance = boost::lexical_cast<int>(val);
+            def.groupChance = XMLValue::Value<int>(cNode);
         }
         if (name == "allowDuplicates")
         {
@@ -241,7 +239,7 @@ void CustomStore::ParseStoreNode(rapidxml::xml_node<char>* node)
 
                     if (cStoreNode->first_attribute("group"))
                     {
-                        group = boost::lexical_cast<int>(cStoreNode->first_attribute("group")->value());
+                        group = XMLValue::Attribute<int>(cStoreNode, "group");
                     }
 
                     def.categories[group].push_back(cat);
@@ -249,7 +247,7 @@ void CustomStore::ParseStoreNode(rapidxml::xml_node<char>* node)
 
                 if (cStoreName == "itemPurchaseLimit")
                 {
-                    def.purchaseLimit = boost::lexical_cast<int>(cStoreNode->value());
+                    def.purchaseLimit = XMLValue::Value<int>(cStoreNode);
                 }
             }
 
@@ -558,11 +556,11 @@ std::vector<StoreBox*> StoreComplete::CreateCustomStoreBoxes(const StoreCategory
             {
                 std::string species = i.blueprint;
 
-                auto potentialList = G_->GetBlueprints()->GetBlueprintList(i.blueprint);
+                const std::string *picked = BlueprintListRegistry::Pick(i.blueprint);
 
-                if (!potentialList.empty())
+                if (picked)
                 {
-                    species = potentialList[random32() % potentialList.size()];
+                    species = *picked;
                 }
 
                 CrewBlueprint bp = G_->GetBlueprints()->GetCrewBlueprint(species);
@@ -3,7 +3,8 @@
 #include "TemporalSystem.h"
 #include "CustomShipSelect.h"
 #include "CustomShips.h"
-#include <boost/lexical_cast.hpp>
+#include "CustomLocalization.h"
+#include "XMLValue.h"
 
 #include <cmath>
 
@@ -59,20 +60,20 @@ void CustomMindSystem::ParseSystemNode(rapidxml::xml_node<char>* node)
         if (level < 4) 
         {
             CustomMindSystem::MindLevel& mindLevel = levels[level];
-            if (levelNode->first_attribute("damageBoost")) mindLevel.damageBoost = boost::lexical_cast<float>(levelNode->first_attribute("damageBoost")->value());
-            if (levelNode->first_attribute("healthBoost")) mindLevel.healthBoost = boost::lexical_cast<float>(levelNode->first_attribute("healthBoost")->value());
-            if (levelNode->first_attribute("duration")) mindLevel.duration = boost::lexical_cast<float>(levelNode->first_attribute("duration")->value());
-            if (levelNode->first_attribute("lock")) mindLevel.lock = boost::lexical_cast<int>(levelNode->first_attribute("lock")->value());
-            if (levelNode->first_attribute("count")) mindLevel.count = boost::lexical_cast<int>(levelNode->first_attribute("count")->value());
+            if (levelNode->first_attribute("damageBoost")) mindLevel.damageBoost = XMLValue::Attribute<float>(levelNode, "damageBoost");
+            if (levelNode->first_attribute("healthBoost")) mindLevel.healthBoost = XMLValue::Attribute<float>(levelNode, "healthBoost");
+            if (levelNode->first_attribute("duration")) mindLevel.duration = XMLValue::Attribute<float>(levelNode, "duration");
+            if (levelNode->first_attribute("lock")) mindLevel.lock = XMLValue::Attribute<int>(levelNode, "lock");
+            if (levelNode->first_attribute("count")) mindLevel.count = XMLValue::Attribute<int>(levelNode, "count");
         }
         else //Construct new levels, using DefaultLevel to substitute unspecified values
         {
             CustomMindSystem::MindLevel mindLevel {
-                levelNode->first_attribute("damageBoost") ? boost::lexical_cast<float>(levelNode->first_attribute("damageBoost")->value()) : defaultLevel.damageBoost,
-                levelNode->first_attribute("healthBoost") ? boost::lexical_cast<float>(levelNode->first_attribute("healthBoost")->value()) : defaultLevel.healthBoost,
-                levelNode->first_attribute("duration") ? boost::lexical_cast<float>(levelNode->first_attribute("duration")->value()) : defaultLevel.duration,
-                levelNode->first_attribute("lock") ? boost::lexical_cast<int>(levelNode->first_attribute("lock")->value()) : defaultLevel.lock,
-                levelNode->first_attribute("count") ? mindLevel.count = boost::lexical_cast<int>(levelNode->first_attribute("count")->value()) : defaultLevel.count
+                levelNode->first_attribute("damageBoost") ? XMLValue::Attribute<float>(levelNode, "damageBoost") : defaultLevel.damageBoost,
+                levelNode->first_attribute("healthBoost") ? XMLValue::Attribute<float>(levelNode, "healthBoost") : defaultLevel.healthBoost,
+                levelNode->first_attribute("duration") ? XMLValue::Attribute<float>(levelNode, "duration") : defaultLevel.duration,
+                levelNode->first_attribute("lock") ? XMLValue::Attribute<int>(levelNode, "lock") : defaultLevel.lock,
+                levelNode->first_attribute("count") ? mindLevel.count = XMLValue::Attribute<int>(levelNode, "count") : defaultLevel.count
             };
             levels.push_back(mindLevel);
         }
@@ -114,24 +115,24 @@ void CustomCloneSystem::ParseSystemNode(rapidxml::xml_node<char>* node)
         if (level < 4) 
         {
             CustomCloneSystem::CloneLevel& mindLevel = levels[level];
-            if (levelNode->first_attribute("jumpHP")) mindLevel.jumpHP = boost::lexical_cast<int>(levelNode->first_attribute("jumpHP")->value());
-            if (levelNode->first_attribute("jumpHPPercent")) mindLevel.jumpHPPercent = boost::lexical_cast<int>(levelNode->first_attribute("jumpHPPercent")->value());
-            if (levelNode->first_attribute("cloneHPPercent")) mindLevel.cloneHPPercent = boost::lexical_cast<int>(levelNode->first_attribute("cloneHPPercent")->value());
-            if (levelNode->first_attribute("skillLossPercent")) mindLevel.skillLossPercent = boost::lexical_cast<int>(levelNode->first_attribute("skillLossPercent")->value());
-            if (levelNode->first_attribute("cloneSpeed")) mindLevel.cloneSpeed = boost::lexical_cast<float>(levelNode->first_attribute("cloneSpeed")->value());
-            if (levelNode->first_attribute("deathSpeed")) mindLevel.deathSpeed = boost::lexical_cast<float>(levelNode->first_attribute("deathSpeed")->value());
-            if (levelNode->first_attribute("count")) mindLevel.count = boost::lexical_cast<int>(levelNode->first_attribute("count")->value());
+            if (levelNode->first_attribute("jumpHP")) mindLevel.jumpHP = XMLValue::Attribute<int>(levelNode, "jumpHP");
+            if (levelNode->first_attribute("jumpHPPercent")) mindLevel.jumpHPPercent = XMLValue::Attribute<int>(levelNode, "jumpHPPercent");
+            if (levelNode->first_attribute("cloneHPPercent")) mindLevel.cloneHPPercent = XMLValue::Attribute<int>(levelNode, "cloneHPPercent");
+            if (levelNode->first_attribute("skillLossPercent")) mindLevel.skillLossPercent = XMLValue::Attribute<int>(levelNode, "skillLossPercent");
+            if (levelNode->first_attribute("cloneSpeed")) mindLevel.cloneSpeed = XMLValue::Attribute<float>(levelNode, "cloneSpeed");
+            if (levelNode->first_attribute("deathSpeed")) mindLevel.deathSpeed = XMLValue::Attribute<float>(levelNode, "deathSpeed");
+            if (levelNode->first_attribute("count")) mindLevel.count = XMLValue::Attribute<int>(levelNode, "count");
         }
         else //Construct new levels, using DefaultLevel to substitute unspecified values
         {
             CustomCloneSystem::CloneLevel mindLevel {
-                levelNode->first_attribute("jumpHP") ? boost::lexical_cast<int>(levelNode->first_attribute("jumpHP")->value()) : defaultLevel.jumpHP,
-                levelNode->first_attribute("jumpHPPercent") ? boost::lexical_cast<int>(levelNode->first_attribute("jumpHPPercent")->value()) : defaultLevel.jumpHPPercent,
-                levelNode->first_attribute("cloneHPPercent") ? boost::lexical_cast<int>(levelNode->first_attribute("cloneHPPercent")->value()) : defaultLevel.cloneHPPercent,
-                levelNode->first_attribute("skillLossPercent") ? boost::lexical_cast<int>(levelNode->first_attribute("skillLossPercent")->value()) : defaultLevel.skillLossPercent,
-                levelNode->first_attribute("cloneSpeed") ? boost::lexical_cast<float>(levelNode->first_attribute("cloneSpeed")->value()) : defaultLevel.cloneSpeed,
-                levelNode->first_attribute("deathSpeed") ? boost::lexical_cast<float>(levelNode->first_attribute("deathSpeed")->value()) : defaultLevel.deathSpeed,
-                levelNode->first_attribute("count") ? boost::lexical_cast<int>(levelNode->first_attribute("count")->value()) : defaultLevel.count
+                levelNode->first_attribute("jumpHP") ? XMLValue::Attribute<int>(levelNode, "jumpHP") : defaultLevel.jumpHP,
+                levelNode->first_attribute("jumpHPPercent") ? XMLValue::Attribute<int>(levelNode, "jumpHPPercent") : defaultLevel.jumpHPPercent,
+                levelNode->first_attribute("cloneHPPercent") ? XMLValue::Attribute<int>(levelNode, "cloneHPPercent") : defaultLevel.cloneHPPercent,
+                levelNode->first_attribute("skillLossPercent") ? XMLValue::Attribute<int>(levelNode, "skillLossPercent") : defaultLevel.skillLossPercent,
+                levelNode->first_attribute("cloneSpeed") ? XMLValue::Attribute<float>(levelNode, "cloneSpeed") : defaultLevel.cloneSpeed,
+                levelNode->first_attribute("deathSpeed") ? XMLValue::Attribute<float>(levelNode, "deathSpeed") : defaultLevel.deathSpeed,
+                levelNode->first_attribute("count") ? XMLValue::Attribute<int>(levelNode, "count") : defaultLevel.count
             };
             levels.push_back(mindLevel);
         }
@@ -1375,6 +1376,7 @@ HOOK_METHOD(TextLibrary, GetText, (const std::string &name, const std::string &l
 
     if (name == "clone_full")
     {
+        TextLibraryCache::MarkVolatile();
         CustomCloneSystem::CloneLevel& glevel = CustomCloneSystem::GetLevel(g_clonePercentTooltipLevel);
         if (glevel.jumpHPPercent > 0)
         {
@@ -1383,6 +1385,7 @@ HOOK_METHOD(TextLibrary, GetText, (const std::string &name, const std::string &l
             if (pos != std::string::npos) ret.replace(pos, 2, glevel.jumpHP > 0 ? "\\2 + " : "" + std::to_string(glevel.jumpHPPercent) + "%");
         }
     }
+    if (name == "clonebay_health" || name == "clonebay_damaged") TextLibraryCache::MarkVolatile();
     if ((name == "clonebay_health" || name == "clonebay_damaged") && G_->GetShipManager(0)->cloneSystem != nullptr)
     {
         CustomCloneSystem::CloneLevel& glevel = CustomCloneSystem::GetLevel(G_->GetShipManager(0)->cloneSystem->healthState.first);
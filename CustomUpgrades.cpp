@@ -361,7 +361,7 @@ HOOK_METHOD(Upgrades, OnInit, (ShipManager *ship) -> void)
 
     box = G_->GetResources()->GetImageId("upgradeUI/Equipment/upgrades_main.png");
 
-    auto def = CustomShipSelect::GetInstance()->GetDefinition(ship->myBlueprint.blueprintName);
+    const CustomShipDefinition &def = CustomShipSelect::GetInstance()->GetDefinition(ship->myBlueprint.blueprintName);
 
     int sysLimit = def.systemLimit;
     int subsystemLimit = def.subsystemLimit;
@@ -3,7 +3,7 @@
 #include "CustomDamage.h"
 #include "CrewMember_Extend.h"
 #include "Projectile_Extend.h"
-#include <boost/lexical_cast.hpp>
+#include "XMLValue.h"
 #include <boost/algorithm/string.hpp>
 #include <iomanip>
 #include <float.h>
@@ -31,7 +31,7 @@ HOOK_METHOD(BlueprintManager, ProcessWeaponBlueprint, (rapidxml::xml_node<char>*
 
         if (name == "freeMissileChance")
         {
-            weaponDef.freeMissileChance = boost::lexical_cast<int>(val);
+            weaponDef.freeMissileChance = XMLValue::Value<int>(child);
         }
         if (name == "descriptionOverride")
         {
@@ -80,12 +80,12 @@ HOOK_METHOD(BlueprintManager, ProcessWeaponBlueprint, (rapidxml::xml_node<char>*
         if (name == "accuracyMod")
         {
             hasCustomDamage = true;
-            weaponDef.customDamage->accuracyMod = boost::lexical_cast<int>(val);
+            weaponDef.customDamage->accuracyMod = XMLValue::Value<int>(child);
         }
         if (name == "droneAccuracyMod")
         {
             hasCustomDamage = true;
-            weaponDef.customDamage->droneAccuracyMod = boost::lexical_cast<int>(val);
+            weaponDef.customDamage->droneAccuracyMod = XMLValue::Value<int>(child);
         }
         if (name == "noSysDamage")
         {
@@ -112,16 +112,16 @@ HOOK_METHOD(BlueprintManager, ProcessWeaponBlueprint, (rapidxml::xml_node<char>*
         }
         if (name == "fireTime")
         {
-            weaponDef.fireTime = boost::lexical_cast<float>(val);
+            weaponDef.fireTime = XMLValue::Value<float>(child);
         }
         if (name == "angularRadius") // affects flak drones
         {
-            weaponDef.angularRadius = boost::lexical_cast<float>(val);
+            weaponDef.angularRadius = XMLValue::Value<float>(child);
         }
         if (name == "statBoostChance")
         {
             hasCustomDamage = true;
-            weaponDef.customDamage->statBoostChance = boost::lexical_cast<int>(val);
+            weaponDef.customDamage->statBoostChance = XMLValue::Value<int>(child);
         }
         if (name == "statBoosts")
         {
@@ -137,7 +137,7 @@ HOOK_METHOD(BlueprintManager, ProcessWeaponBlueprint, (rapidxml::xml_node<char>*
         if (name == "roomStatBoostChance")
         {
             hasCustomDamage = true;
-            weaponDef.customDamage->roomStatBoostChance = boost::lexical_cast<int>(val);
+            weaponDef.customDamage->roomStatBoostChance = XMLValue::Value<int>(child);
         }
         if (name == "roomStatBoosts")
         {
@@ -153,7 +153,7 @@ HOOK_METHOD(BlueprintManager, ProcessWeaponBlueprint, (rapidxml::xml_node<char>*
         if (name == "crewSpawnChance")
         {
             hasCustomDamage = true;
-            weaponDef.customDamage->crewSpawnChance = boost::lexical_cast<int>(val);
+            weaponDef.customDamage->crewSpawnChance = XMLValue::Value<int>(child);
         }
         if (name == "spawnCrew")
         {
@@ -174,7 +174,7 @@ HOOK_METHOD(BlueprintManager, ProcessWeaponBlueprint, (rapidxml::xml_node<char>*
         if (name == "erosionChance")
         {
             hasCustomDamage = true;
-            weaponDef.customDamage->erosionChance = boost::lexical_cast<int>(val);
+            weaponDef.customDamage->erosionChance = XMLValue::Value<int>(child);
         }
 
         if (name == "iconReplace")
@@ -183,7 +183,7 @@ HOOK_METHOD(BlueprintManager, ProcessWeaponBlueprint, (rapidxml::xml_node<char>*
         }
         if (name == "iconScale")
         {
-            weaponDef.iconScale = boost::lexical_cast<float>(val);
+            weaponDef.iconScale = XMLValue::Value<float>(child);
         }
 
         if (name == "projectiles")
@@ -654,7 +654,7 @@ HOOK_METHOD(ProjectileFactory, constructor, (const WeaponBlueprint* bp, int ship
     }
     
     auto context = G_->getLuaContext();
-    SWIG_NewPointerObj(context->GetLua(), this, context->getLibScript()->types.pProjectileFactory, 0);
+    LuaLibScript::push_cached_pointer(context->GetLua(), this, context->getLibScript()->types.pProjectileFactory);
     context->getLibScript()->call_on_internal_event_callbacks(InternalEvents::CONSTRUCT_PROJECTILE_FACTORY, 1);
     lua_pop(context->GetLua(), 1);
 }
@@ -774,8 +774,8 @@ HOOK_METHOD_PRIORITY(ProjectileFactory, GetProjectile, -1000, () -> Projectile*)
 
         // Callback with Projectile and ProjectileFactory
         auto context = Global::GetInstance()->getLuaContext();
-        SWIG_NewPointerObj(context->GetLua(), ret, context->getLibScript()->types.pProjectile[ret->GetType()], 0);
-        SWIG_NewPointerObj(context->GetLua(), this, context->getLibScript()->types.pProjectileFactory, 0);
+        LuaLibScript::push_cached_pointer(context->GetLua(), ret, context->getLibScript()->types.pProjectile[ret->GetType()]);
+        LuaLibScript::push_cached_pointer(context->GetLua(), this, context->getLibScript()->types.pProjectileFactory);
         context->getLibScript()->call_on_internal_chain_event_callbacks(InternalEvents::PROJECTILE_FIRE, 2, 0);
         lua_pop(context->GetLua(), 2);
     }
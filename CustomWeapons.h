@@ -60,9 +60,10 @@ public:
 
     CustomWeaponDefinition* GetWeaponDefinition(const std::string& bpName)
     {
-        if (weaponDefs.find(bpName) != weaponDefs.end())
+        auto it = weaponDefs.find(bpName);
+        if (it != weaponDefs.end())
         {
-            return &weaponDefs[bpName];
+            return &it->second;
         }
 
         return nullptr;
@@ -1,7 +1,7 @@
 #include "EnemyShipIcons.h"
 #include "CustomShipSelect.h"
 #include "CustomAugments.h"
-#include <boost/lexical_cast.hpp>
+#include "XMLValue.h"
 
 ShipIconManager* ShipIconManager::instance = new ShipIconManager();
 
@@ -13,13 +13,13 @@ void ShipIconManager::ParseShipIconNode(rapidxml::xml_node<char>* node)
 
         if (name == "normalPos")
         {
-            normalBoxPos.x = boost::lexical_cast<float>(child->first_attribute("x")->value());
-            normalBoxPos.y = boost::lexical_cast<float>(child->first_attribute("y")->value());
+            normalBoxPos.x = XMLValue::Attribute<float>(child, "x");
+            normalBoxPos.y = XMLValue::Attribute<float>(child, "y");
         }
         if (name == "bossPos")
         {
-            bossBoxPos.x = boost::lexical_cast<float>(child->first_attribute("x")->value());
-            bossBoxPos.y = boost::lexical_cast<float>(child->first_attribute("y")->value());
+            bossBoxPos.x = XMLValue::Attribute<float>(child, "x");
+            bossBoxPos.y = XMLValue::Attribute<float>(child, "y");
         }
 
         if (name == "shipIcon")
@@ -3,7 +3,7 @@
 #include "CustomDamage.h"
 #include "TemporalSystem.h"
 
-#include <boost/lexical_cast.hpp>
+#include "XMLValue.h"
 
 ErosionEffect ErosionEffect::defaultErosionEffect = ErosionEffect();
 
@@ -17,30 +17,29 @@ void ErosionEffect::ParseErosionEffect(rapidxml::xml_node<char>* node)
     for (auto child = node->first_node(); child; child = child->next_sibling())
     {
         std::string name = child->name();
-        std::string val = child->value();
         if (name == "speed")
         {
-            this->erosionSpeed = boost::lexical_cast<float>(val);
+            this->erosionSpeed = XMLValue::Value<float>(child);
         }
         if (name == "maxSpeed")
         {
-            this->erosionSpeedMax = boost::lexical_cast<float>(val);
+            this->erosionSpeedMax = XMLValue::Value<float>(child);
         }
         if (name == "time")
         {
-            this->erosionTime = boost::lexical_cast<float>(val);
+            this->erosionTime = XMLValue::Value<float>(child);
         }
         if (name == "maxTime")
         {
-            this->erosionTimeMax = boost::lexical_cast<float>(val);
+            this->erosionTimeMax = XMLValue::Value<float>(child);
         }
         if (name == "systemRepairMultiplier")
         {
-            this->systemRepairMultiplier = boost::lexical_cast<float>(val);
+            this->systemRepairMultiplier = XMLValue::Value<float>(child);
         }
         if (name == "erodeShields")
         {
-            this->erodeShields = EventsParser::ParseBoolean(val);
+            this->erodeShields = EventsParser::ParseBoolean(child->value());
         }
         if (name == "roomAnim")
         {
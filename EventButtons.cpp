@@ -1,7 +1,7 @@
 #include "EventButtons.h"
 #include "CustomEvents.h"
 #include "Resources.h"
-#include <boost/lexical_cast.hpp>
+#include "XMLValue.h"
 #include <algorithm>
 
 EventButtonManager* EventButtonManager::instance = new EventButtonManager();
@@ -37,7 +37,7 @@ EventButtonDefinition* EventButtonManager::ParseEventButton(rapidxml::xml_node<c
             def->image = child->value();
             if (child->first_attribute("border"))
             {
-                def->margin_border = boost::lexical_cast<int>(child->first_attribute("border")->value());
+                def->margin_border = XMLValue::Attribute<int>(child, "border");
             }
         }
         else if (strcmp(child->name(), "text") == 0)
@@ -50,23 +50,23 @@ EventButtonDefinition* EventButtonManager::ParseEventButton(rapidxml::xml_node<c
             }
             if (child->first_attribute("border"))
             {
-                def->margin_text = boost::lexical_cast<int>(child->first_attribute("border")->value());
+                def->margin_text = XMLValue::Attribute<int>(child, "border");
             }
         }
         else if (strcmp(child->name(), "location") == 0)
         {
-            def->location = boost::lexical_cast<int>(child->value());
+            def->location = XMLValue::Value<int>(child);
         }
         else if (strcmp(child->name(), "customLocation") == 0)
         {
             def->location = -1;
             if (child->first_attribute("x"))
             {
-                def->customLocation.x = boost::lexical_cast<int>(child->first_attribute("x")->value());
+                def->customLocation.x = XMLValue::Attribute<int>(child, "x");
             }
             if (child->first_attribute("y"))
             {
-                def->customLocation.y = boost::lexical_cast<int>(child->first_attribute("y")->value());
+                def->customLocation.y = XMLValue::Attribute<int>(child, "y");
             }
         }
         else if (strcmp(child->name(), "tooltip") == 0)
@@ -92,12 +92,12 @@ EventButtonDefinition* EventButtonManager::ParseEventButton(rapidxml::xml_node<c
             def->req = child->value();
             if (child->first_attribute("max_lvl"))
             {
-                def->max_lvl = boost::lexical_cast<int>(child->first_attribute("max_lvl")->value());
+                def->max_lvl = XMLValue::Attribute<int>(child, "max_lvl");
                 def->lvl = -2147483647;
             }
             if (child->first_attribute("lvl"))
             {
-                def->lvl = boost::lexical_cast<int>(child->first_attribute("lvl")->value());
+                def->lvl = XMLValue::Attribute<int>(child, "lvl");
             }
         }
         else if (strcmp(child->name(), "color") == 0)
@@ -1,5 +1,5 @@
 #include "HullNumbers.h"
-#include <boost/lexical_cast.hpp>
+#include "XMLValue.h"
 
 HullNumbers HullNumbers::instance = HullNumbers();
 HullBars HullBars::instance = HullBars();
@@ -12,15 +12,15 @@ HullNumbers::IndicatorInfo& HullNumbers::ParseIndicatorInfo(HullNumbers::Indicat
 {
     if (node->first_attribute("x"))
     {
-        indicatorInfo.x = boost::lexical_cast<int>(node->first_attribute("x")->value());
+        indicatorInfo.x = XMLValue::Attribute<int>(node, "x");
     }
     if (node->first_attribute("y"))
     {
-        indicatorInfo.y = boost::lexical_cast<int>(node->first_attribute("y")->value());
+        indicatorInfo.y = XMLValue::Attribute<int>(node, "y");
     }
     if (node->first_attribute("type"))
     {
-        indicatorInfo.type = boost::lexical_cast<int>(node->first_attribute("type")->value());
+        indicatorInfo.type = XMLValue::Attribute<int>(node, "type");
     }
     if (node->first_attribute("align"))
     {
@@ -119,7 +119,7 @@ void HullNumbers::ParseHullNumbersNode(rapidxml::xml_node<char>* node)
     }
 }
 
-void HullNumbers::PrintAlignment(int font, int x, int y, std::string str, std::string align)
+void HullNumbers::PrintAlignment(int font, int x, int y, const std::string &str, const std::string &align)
 {
     if (align == "center")
     {
@@ -141,15 +141,15 @@ void HullBars::ParseHullBarsNode(rapidxml::xml_node<char> *node)
     {
         if (node->first_attribute("type"))
         {
-            enabledType = boost::lexical_cast<int>(node->first_attribute("type")->value());
+            enabledType = XMLValue::Attribute<int>(node, "type");
         }
         if (node->first_attribute("maxHull"))
         {
-            barWidth = boost::lexical_cast<int>(node->first_attribute("maxHull")->value());
+            barWidth = XMLValue::Attribute<int>(node, "maxHull");
         }
         if (node->first_attribute("maxHullBoss"))
         {
-            barWidthBoss = boost::lexical_cast<int>(node->first_attribute("maxHullBoss")->value());
+            barWidthBoss = XMLValue::Attribute<int>(node, "maxHullBoss");
         }
 
         for (auto child = node->first_node("barColor"); child; child = child->next_sibling("barColor"))
@@ -184,19 +184,19 @@ void HullBars::ParseHullBarsColorsNode(rapidxml::xml_node<char> *node)
 
     if (node->first_attribute("r"))
     {
-        r = boost::lexical_cast<float>(node->first_attribute("r")->value()) / 255.f;
+        r = XMLValue::Attribute<float>(node, "r") / 255.f;
     }
     if (node->first_attribute("g"))
     {
-        g = boost::lexical_cast<float>(node->first_attribute("g")->value()) / 255.f;
+        g = XMLValue::Attribute<float>(node, "g") / 255.f;
     }
     if (node->first_attribute("b"))
     {
-        b = boost::lexical_cast<float>(node->first_attribute("b")->value()) / 255.f;
+        b = XMLValue::Attribute<float>(node, "b") / 255.f;
     }
     if (node->first_attribute("a"))
     {
-        a = boost::lexical_cast<float>(node->first_attribute("a")->value()) / 255.f;
+        a = XMLValue::Attribute<float>(node, "a") / 255.f;
     }
     barColor.push_back(GL_Color(r, g, b ,a));
 }
@@ -211,7 +211,7 @@ HOOK_METHOD(ShipStatus, RenderShields, (bool renderText) -> void)
     {
         char buffer[64];
         sprintf(buffer, "%d", this->ship->ship.hullIntegrity.first);
-        auto textInfo = HNManager->playerIndicator;
+        const HullNumbers::IndicatorInfo &textInfo = HNManager->playerIndicator;
         HullNumbers::PrintAlignment(textInfo.type, textInfo.x, textInfo.y, buffer, textInfo.align);
     }
 }
@@ -277,17 +277,17 @@ HOOK_METHOD(CombatControl, RenderTarget, () -> void)
         char buffer[64];
         sprintf(buffer, "%d", this->GetCurrentTarget()->ship.hullIntegrity.first);
 
-        HullNumbers::IndicatorInfo textInfo;
+        const HullNumbers::IndicatorInfo *textInfo;
         if (boss_visual)
         {
             auto it = HNManager->bossIndicatorLoc.find(G_->GetTextLibrary()->currentLanguage);
             if (it != std::end(HNManager->bossIndicatorLoc))
             {
-                textInfo = it->second;
+                textInfo = &it->second;
             }
             else
             {
-                textInfo = HNManager->bossIndicator;
+                textInfo = &HNManager->bossIndicator;
             }
         }
         else
@@ -295,15 +295,15 @@ HOOK_METHOD(CombatControl, RenderTarget, () -> void)
             auto it = HNManager->enemyIndicatorLoc.find(G_->GetTextLibrary()->currentLanguage);
             if (it != std::end(HNManager->enemyIndicatorLoc))
             {
-                textInfo = it->second;
+                textInfo = &it->second;
             }
             else
             {
-                textInfo = HNManager->enemyIndicator;
+                textInfo = &HNManager->enemyIndicator;
             }
         }
 
-        HullNumbers::PrintAlignment(textInfo.type, textInfo.x, textInfo.y, buffer, textInfo.align);
+        HullNumbers::PrintAlignment(textInfo->type, textInfo->x, textInfo->y, buffer, textInfo->align);
     }
 }
 
@@ -26,7 +26,7 @@ public:
 
     bool enabled;
 
-    static void PrintAlignment(int font, int x, int y, std::string str, std::string align);
+    static void PrintAlignment(int font, int x, int y, const std::string &str, const std::string &align);
     static HullNumbers *GetInstance() { return &instance; }
 private:
 
@@ -1,5 +1,5 @@
 #include "MainMenu.h"
-#include <boost/lexical_cast.hpp>
+#include "XMLValue.h"
 
 CustomMainMenu CustomMainMenu::instance = CustomMainMenu();
 
@@ -11,11 +11,11 @@ void CustomMainMenu::ParseTitleScreenNode(rapidxml::xml_node<char> *node)
     }
     if (node->first_attribute("logo_x"))
     {
-        logoX = boost::lexical_cast<int>(node->first_attribute("logo_x")->value());
+        logoX = XMLValue::Attribute<int>(node, "logo_x");
     }
     if (node->first_attribute("logo_y"))
     {
-        logoY = boost::lexical_cast<int>(node->first_attribute("logo_y")->value());
+        logoY = XMLValue::Attribute<int>(node, "logo_y");
     }
 
     for (auto child = node->first_node(); child; child = child->next_sibling())
@@ -32,13 +32,13 @@ void CustomMainMenu::ParseTitleScreenNode(rapidxml::xml_node<char> *node)
                     SplashImage splashImage = SplashImage();
 
                     if (splash->first_attribute("x"))
-                        splashImage.x = boost::lexical_cast<int>(splash->first_attribute("x")->value());
+                        splashImage.x = XMLValue::Attribute<int>(splash, "x");
                     if (splash->first_attribute("y"))
-                        splashImage.y = boost::lexical_cast<int>(splash->first_attribute("y")->value());
+                        splashImage.y = XMLValue::Attribute<int>(splash, "y");
                     if (splash->first_attribute("center"))
                         splashImage.center = EventsParser::ParseBoolean(splash->first_attribute("center")->value());
                     if (splash->first_attribute("chance"))
-                        splashImage.chance = boost::lexical_cast<int>(splash->first_attribute("chance")->value());
+                        splashImage.chance = XMLValue::Attribute<int>(splash, "chance");
 
                     splashImage.image = splash->value();
 
@@ -1,8 +1,10 @@
 #include "Global.h"
 #include "CustomCrew.h"
+#include "CustomLocalization.h"
 #include "ShipUnlocks.h"
 #include "EnemyShipIcons.h"
 #include "CustomOptions.h"
+#include "Resources.h"
 
 #include <sstream>
 #include <vector>
@@ -405,9 +407,13 @@ HOOK_METHOD(SpaceStatus, OnRender, () -> void)
 HOOK_METHOD_PRIORITY(SpaceStatus, RenderWarningText, 9999, (int effect, int textOffset) -> void)
 {
     LOG_HOOK("HOOK_METHOD_PRIORITY -> SpaceStatus::RenderWarningText -> Begin (Misc.cpp)\n")
+    static ImageHandle warningYellow("warnings/backglow_warning_yellow.png");
+    static ImageHandle warningGreen("warnings/backglow_warning_green.png");
+    static ImageHandle warningRed("warnings/backglow_warning_red.png");
+
     GL_Texture *tex;
     GL_Color color;
-    std::string text;
+    const std::string *text;
   
     color.g = 1.0;
     color.a = 1.0;
@@ -417,15 +423,15 @@ HOOK_METHOD_PRIORITY(SpaceStatus, RenderWarningText, 9999, (int effect, int text
         color.g = 255.f / 255.f;
         color.r = 255.f / 255.f;
 
-        tex = G_->GetResources()->GetImageId("warnings/backglow_warning_yellow.png");
-        text = G_->GetTextLibrary()->GetText("warning_pds_all");
+        tex = warningYellow.Get();
+        text = &TextLibraryCache::GetText("warning_pds_all");
     }
     else if (effect == 9) 
     {
         color.r = 0.4705882;
         color.b = 0.4705882;
-        tex = G_->GetResources()->GetImageId("warnings/backglow_warning_green.png");
-        text = G_->GetTextLibrary()->GetText("warning_pds_allies");
+        tex = warningGreen.Get();
+        text = &TextLibraryCache::GetText("warning_pds_allies");
     }
     else 
     {
@@ -439,15 +445,15 @@ HOOK_METHOD_PRIORITY(SpaceStatus, RenderWarningText, 9999, (int effect, int text
         color.g = 50.f / 255.f;
         color.r = 255.f / 255.f;
 
-        tex = G_->GetResources()->GetImageId("warnings/backglow_warning_red.png");
-        text = G_->GetTextLibrary()->GetText("warning_environment_danger");
+        tex = warningRed.Get();
+        text = &TextLibraryCache::GetText("warning_environment_danger");
     }
 
     Point textPos = Point(textOffset + position.x, position.y + 51);
-    Pointf textSize = freetype::easy_measurePrintLines(52, 0.0, 0.0, 999, text);
+    Pointf textSize = freetype::easy_measurePrintLines(52, 0.0, 0.0, 999, *text);
     CSurface::GL_BlitImage(tex, textPos.x - (int)textSize.x / 2, textPos.y - 1, (int)textSize.x, (int)textSize.y, 0.0, GL_Color(1.0, 1.0, 1.0, 1.0), false);
     CSurface::GL_SetColor(color);
-    freetype::easy_printCenter(52, textPos.x, textPos.y, text);
+    freetype::easy_printCenter(52, textPos.x, textPos.y, *text);
     CSurface::GL_SetColor(GL_Color(1.0, 1.0, 1.0, 1.0));
     return;
 }
@@ -588,6 +594,46 @@ void LuaLibScript::LoadTypeInfo()
     types.pShipSystemTypes[SYS_TEMPORAL] = SWIG_TypeQuery(this->m_Lua, "ShipSystem *"); // eventually reimplement temporal as TemporalSystem class?
 }
 
+void LuaLibScript::push_cached_pointer(lua_State* lua, void* ptr, swig_type_info* type)
+{
+    if (ptr == nullptr)
+    {
+        SWIG_NewPointerObj(lua, ptr, type, 0);
+        return;
+    }
+
+    lua_getfield(lua, LUA_REGISTRYINDEX, HS_USERDATA_CACHE);
+    if (!lua_istable(lua, -1))
+    {
+        // values are weak so proxies no script holds on to are still collected
+        lua_pop(lua, 1);
+        lua_newtable(lua);
+        lua_newtable(lua);
+        lua_pushstring(lua, "v");
+        lua_setfield(lua, -2, "__mode");
+        lua_setmetatable(lua, -2);
+        lua_pushvalue(lua, -1);
+        lua_setfield(lua, LUA_REGISTRYINDEX, HS_USERDATA_CACHE);
+    }
+
+    lua_rawgetp(lua, -1, ptr);
+    if (lua_isuserdata(lua, -1))
+    {
+        swig_lua_userdata *usr = (swig_lua_userdata*) lua_touserdata(lua, -1);
+        if (usr->type == type && usr->ptr == ptr)
+        {
+            lua_remove(lua, -2);
+            return;
+        }
+    }
+    lua_pop(lua, 1);
+
+    SWIG_NewPointerObj(lua, ptr, type, 0);
+    lua_pushvalue(lua, -1);
+    lua_rawsetp(lua, -3, ptr);
+    lua_remove(lua, -2);
+}
+
 int LuaLibScript::l_on_load(lua_State* lua)
 {
     luaL_argcheck(lua, lua_isfunction(lua, 1), 1, "function expected!");
@@ -1233,7 +1279,7 @@ HOOK_METHOD_PRIORITY(CrewMember, OnLoop, -100, () -> void)
 
     auto context = Global::GetInstance()->getLuaContext();
 
-    SWIG_NewPointerObj(context->GetLua(), this, context->getLibScript()->types.pCrewMember, 0);
+    LuaLibScript::push_cached_pointer(context->GetLua(), this, context->getLibScript()->types.pCrewMember);
     context->getLibScript()->call_on_internal_event_callbacks(InternalEvents::CREW_LOOP, 1);
     lua_pop(context->GetLua(), 1);
 }
@@ -1244,7 +1290,7 @@ HOOK_METHOD_PRIORITY(ShipManager, OnLoop, -100, () -> void)
     super();
 
     auto context = G_->getLuaContext();
-    SWIG_NewPointerObj(context->GetLua(), this, context->getLibScript()->types.pShipManager, 0);
+    LuaLibScript::push_cached_pointer(context->GetLua(), this, context->getLibScript()->types.pShipManager);
     context->getLibScript()->call_on_internal_event_callbacks(InternalEvents::SHIP_LOOP, 1);
     lua_pop(context->GetLua(), 1);
 }
@@ -1282,8 +1328,8 @@ HOOK_METHOD_PRIORITY(SpaceDrone, GetNextProjectile, -100, () -> Projectile*)
     if (ret != nullptr)
     {
         auto context = G_->getLuaContext();
-        SWIG_NewPointerObj(context->GetLua(), ret, context->getLibScript()->types.pProjectile[ret->GetType()], 0);
-        SWIG_NewPointerObj(context->GetLua(), this, context->getLibScript()->types.pSpaceDroneTypes[this->type], 0);
+        LuaLibScript::push_cached_pointer(context->GetLua(), ret, context->getLibScript()->types.pProjectile[ret->GetType()]);
+        LuaLibScript::push_cached_pointer(context->GetLua(), this, context->getLibScript()->types.pSpaceDroneTypes[this->type]);
         bool preempt = context->getLibScript()->call_on_internal_chain_event_callbacks(InternalEvents::DRONE_FIRE, 2, 0);
         lua_pop(context->GetLua(), 2);
         //preempt prevents projectile from firing
@@ -1302,7 +1348,7 @@ HOOK_METHOD(ShipManager, GetDodgeFactor, () -> int)
     int ret = super();
 
     auto context = G_->getLuaContext();
-    SWIG_NewPointerObj(context->GetLua(), this, context->getLibScript()->types.pShipManager, 0);
+    LuaLibScript::push_cached_pointer(context->GetLua(), this, context->getLibScript()->types.pShipManager);
     lua_pushinteger(context->GetLua(), ret);
     context->getLibScript()->call_on_internal_chain_event_callbacks(InternalEvents::GET_DODGE_FACTOR, 2, 1);
     if (lua_isnumber(context->GetLua(), -1)) //Round floats and account for values like 1.0
@@ -1318,7 +1364,7 @@ HOOK_METHOD(ShipSystem, SetBonusPower, (int amount, int permanentPower) -> void)
     LOG_HOOK("HOOK_METHOD -> ShipSystem::SetBonusPower -> Begin (Misc.cpp)\n")
 
     auto context = G_->getLuaContext();
-    SWIG_NewPointerObj(context->GetLua(), this, context->getLibScript()->types.pShipSystem, 0);
+    LuaLibScript::push_cached_pointer(context->GetLua(), this, context->getLibScript()->types.pShipSystem);
     lua_pushinteger(context->GetLua(), amount);
     bool preempt = context->getLibScript()->call_on_internal_chain_event_callbacks(InternalEvents::SET_BONUS_POWER, 2, 1);
     if (lua_isnumber(context->GetLua(), -1)) amount = static_cast<int>(lua_tonumber(context->GetLua(), -1));
@@ -1331,7 +1377,7 @@ HOOK_METHOD(WeaponSystem, SetBonusPower, (int amount, int permanentPower) -> voi
     LOG_HOOK("HOOK_METHOD -> WeaponSystem::SetBonusPower -> Begin (Misc.cpp)\n")
 
     auto context = G_->getLuaContext();
-    SWIG_NewPointerObj(context->GetLua(), this, context->getLibScript()->types.pWeaponSystem, 0);
+    LuaLibScript::push_cached_pointer(context->GetLua(), this, context->getLibScript()->types.pWeaponSystem);
     lua_pushinteger(context->GetLua(), amount);
     bool preempt = context->getLibScript()->call_on_internal_chain_event_callbacks(InternalEvents::SET_BONUS_POWER, 2, 1);
     if (lua_isnumber(context->GetLua(), -1)) amount = static_cast<int>(lua_tonumber(context->GetLua(), -1));
@@ -1344,7 +1390,7 @@ HOOK_METHOD(DroneSystem, SetBonusPower, (int amount, int permanentPower) -> void
     LOG_HOOK("HOOK_METHOD -> DroneSystem::SetBonusPower -> Begin (Misc.cpp)\n")
 
     auto context = G_->getLuaContext();
-    SWIG_NewPointerObj(context->GetLua(), this, context->getLibScript()->types.pDroneSystem, 0);
+    LuaLibScript::push_cached_pointer(context->GetLua(), this, context->getLibScript()->types.pDroneSystem);
     lua_pushinteger(context->GetLua(), amount);
     bool preempt = context->getLibScript()->call_on_internal_chain_event_callbacks(InternalEvents::SET_BONUS_POWER, 2, 1);
     if (lua_isnumber(context->GetLua(), -1)) amount = static_cast<int>(lua_tonumber(context->GetLua(), -1));
@@ -1358,7 +1404,7 @@ HOOK_METHOD(ShipManager, JumpArrive, () -> void)
     LOG_HOOK("HOOK_METHOD -> ShipManager::JumpArrive -> Begin (Misc.cpp)\n")
     super();
     auto context = G_->getLuaContext();
-    SWIG_NewPointerObj(context->GetLua(), this, context->getLibScript()->types.pShipManager, 0);
+    LuaLibScript::push_cached_pointer(context->GetLua(), this, context->getLibScript()->types.pShipManager);
     context->getLibScript()->call_on_internal_event_callbacks(InternalEvents::JUMP_ARRIVE, 1);
     lua_pop(context->GetLua(), 1);
 }
@@ -1368,7 +1414,7 @@ HOOK_METHOD(ShipManager, JumpLeave, () -> void)
     LOG_HOOK("HOOK_METHOD -> ShipManager::JumpLeave -> Begin (Misc.cpp)\n")
     super();
     auto context = G_->getLuaContext();
-    SWIG_NewPointerObj(context->GetLua(), this, context->getLibScript()->types.pShipManager, 0);
+    LuaLibScript::push_cached_pointer(context->GetLua(), this, context->getLibScript()->types.pShipManager);
     context->getLibScript()->call_on_internal_event_callbacks(InternalEvents::JUMP_LEAVE, 1);
     lua_pop(context->GetLua(), 1);
 }
@@ -1390,7 +1436,7 @@ HOOK_METHOD(ShipManager, Wait, () -> void)
     LOG_HOOK("HOOK_METHOD -> ShipManager::Wait -> Begin (Misc.cpp)\n")
     super();
     auto context = G_->getLuaContext();
-    SWIG_NewPointerObj(context->GetLua(), this, context->getLibScript()->types.pShipManager, 0);
+    LuaLibScript::push_cached_pointer(context->GetLua(), this, context->getLibScript()->types.pShipManager);
     context->getLibScript()->call_on_internal_event_callbacks(InternalEvents::ON_WAIT, 1);
     lua_pop(context->GetLua(), 1);
 }
@@ -1532,7 +1578,7 @@ HOOK_METHOD(CrewMember, OnRenderHealth, () -> void)
     LOG_HOOK("HOOK_METHOD -> CrewMember::OnRenderHealth -> Begin (Misc.cpp)\n")
     auto context = Global::GetInstance()->getLuaContext();
 
-    SWIG_NewPointerObj(context->GetLua(), this, context->getLibScript()->types.pCrewMember, 0);
+    LuaLibScript::push_cached_pointer(context->GetLua(), this, context->getLibScript()->types.pCrewMember);
 
     int idx = context->getLibScript()->call_on_render_event_pre_callbacks(RenderEvents::CREW_MEMBER_HEALTH, 1);
     if (idx >= 0) super();
@@ -1547,7 +1593,7 @@ HOOK_METHOD(ShipManager, OnRender, (bool showInterior, bool doorControlMode) ->
     LOG_HOOK("HOOK_METHOD -> ShipManager::OnRender -> Begin (Misc.cpp)\n")
     auto context = Global::GetInstance()->getLuaContext();
 
-    SWIG_NewPointerObj(context->GetLua(), this, context->getLibScript()->types.pShipManager, 0);
+    LuaLibScript::push_cached_pointer(context->GetLua(), this, context->getLibScript()->types.pShipManager);
     lua_pushboolean(context->GetLua(), showInterior);
     lua_pushboolean(context->GetLua(), doorControlMode);
 
@@ -0,0 +1,65 @@
+#include "Global.h"
+#include "Profiler.h"
+#include <cstdlib>
+
+static void WriteProfile()
+{
+    if (!Profiler::Enabled()) return;
+
+    if (Profiler::Dump(Profiler::FileName()))
+    {
+        hs_log_file("Profile written to %s\n", Profiler::FileName());
+    }
+    Profiler::Reset();
+}
+
+static void WriteProfileAtExit()
+{
+    // Sections are reset once written, so this only writes if the game quit without going through CApp::OnExit
+    for (const Profiler::Section &section : Profiler::Sections())
+    {
+        if (section.calls != 0)
+        {
+            WriteProfile();
+            return;
+        }
+    }
+}
+
+static bool RegisterProfileAtExit()
+{
+    if (!Profiler::Enabled()) return false;
+
+    Profiler::Sections(); // construct the section list first so it's still alive when the handler runs
+    return std::atexit(WriteProfileAtExit) == 0;
+}
+
+static bool g_profileAtExit = RegisterProfileAtExit();
+
+static int GetProfileFrameLimit()
+{
+    const char *frames = std::getenv("HS_PROFILE_FRAMES");
+    return frames != nullptr ? std::atoi(frames) : 0;
+}
+
+HOOK_METHOD(CApp, OnExit, () -> void)
+{
+    LOG_HOOK("HOOK_METHOD -> CApp::OnExit -> Begin (Profiler.cpp)\n")
+    WriteProfile();
+    super();
+}
+
+HOOK_METHOD(CApp, OnLoop, () -> void)
+{
+    LOG_HOOK("HOOK_METHOD -> CApp::OnLoop -> Begin (Profiler.cpp)\n")
+    super();
+
+    // Unattended runs: stop after a fixed number of frames so timings from different builds line up
+    static const int frameLimit = GetProfileFrameLimit();
+    static int frames = 0;
+    if (frameLimit > 0 && Profiler::Enabled() && ++frames >= frameLimit)
+    {
+        WriteProfile();
+        Running = false;
+    }
+}
@@ -0,0 +1,110 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+// Timing of Hyperspace logic inside a running game.
+// Enabled from launch by setting the HS_PROFILE environment variable (so startup work like signature
+// scanning and XML parsing is captured), or toggled with the PROFILE console command.
+// Profiler::Dump writes one CSV row per section so timings can be compared between releases.
+// A run enabled from launch writes its CSV (HS_PROFILE_FILE, default hs_profile.csv) when the game exits,
+// and HS_PROFILE_FRAMES=<n> makes the game exit by itself after n frames so runs can be scripted.
+class Profiler
+{
+public:
+    struct Section
+    {
+        const char *name;
+        uint64_t calls;
+        uint64_t totalNs;
+        uint64_t maxNs;
+    };
+
+    static bool &Enabled()
+    {
+        static bool enabled = std::getenv("HS_PROFILE") != nullptr;
+        return enabled;
+    }
+
+    static const char *FileName()
+    {
+        const char *fileName = std::getenv("HS_PROFILE_FILE");
+        return fileName != nullptr && *fileName != '\0' ? fileName : "hs_profile.csv";
+    }
+
+    static std::vector<Section> &Sections()
+    {
+        static std::vector<Section> sections;
+        return sections;
+    }
+
+    static int Register(const char *name)
+    {
+        Sections().push_back({name, 0, 0, 0});
+        return Sections().size() - 1;
+    }
+
+    static void Record(int id, uint64_t ns)
+    {
+        Section &section = Sections()[id];
+        section.calls++;
+        section.totalNs += ns;
+        if (ns > section.maxNs) section.maxNs = ns;
+    }
+
+    static void Reset()
+    {
+        for (Section &section : Sections())
+        {
+            section.calls = 0;
+            section.totalNs = 0;
+            section.maxNs = 0;
+        }
+    }
+
+    static bool Dump(const char *fileName)
+    {
+        FILE *file = fopen(fileName, "w");
+        if (file == nullptr) return false;
+
+        fprintf(file, "section,calls,total_ms,avg_us,max_us\n");
+        for (const Section &section : Sections())
+        {
+            if (section.calls == 0) continue;
+            fprintf(file, "%s,%llu,%.3f,%.3f,%.3f\n",
+                    section.name,
+                    (unsigned long long)section.calls,
+                    section.totalNs / 1000000.0,
+                    section.totalNs / 1000.0 / section.calls,
+                    section.maxNs / 1000.0);
+        }
+        fclose(file);
+        return true;
+    }
+};
+
+class ProfileScope
+{
+public:
+    ProfileScope(int _id) : id{_id}, active{Profiler::Enabled()}
+    {
+        if (active) start = std::chrono::steady_clock::now();
+    }
+
+    ~ProfileScope()
+    {
+        if (active) Profiler::Record(id, std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+    }
+
+private:
+    int id;
+    bool active;
+    std::chrono::steady_clock::time_point start;
+};
+
+// Times the rest of the enclosing scope under the given section name
+#define HS_PROFILE_SCOPE(name) \
+    static const int hsProfileSection = Profiler::Register(name); \
+    ProfileScope hsProfileScope(hsProfileSection)
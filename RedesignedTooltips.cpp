@@ -3,6 +3,7 @@
 #include "CustomAugments.h"
 #include "CustomDrones.h"
 #include "CustomCrew.h"
+#include "CustomLocalization.h"
 #include <boost/lexical_cast.hpp>
 #include <boost/algorithm/string.hpp>
 #include <iomanip>
@@ -10,20 +11,19 @@
 
 std::string GetWeaponStatsString(const WeaponBlueprint* bp, bool drone = false, int dronePower = 0, int droneSpeed = 0)
 {
-    auto tLib = G_->GetTextLibrary();
     std::string descText = "";
     if (drone)
     {
-        descText += "\n\n" + tLib->GetText("description_stats") + "\n";
+        descText += "\n\n" + TextLibraryCache::GetText("description_stats") + "\n";
     }
     std::string currentText = "";
 
     if (drone)
     {
-        currentText = G_->GetTextLibrary()->GetText("required_power");
+        currentText = TextLibraryCache::GetText("required_power");
         descText += boost::algorithm::replace_all_copy(currentText, "\\1", std::to_string(dronePower)) + "\n";
-        descText += G_->GetTextLibrary()->GetText("drone_required") + "\n\n";
-        currentText = tLib->GetText("drone_speed");
+        descText += TextLibraryCache::GetText("drone_required") + "\n\n";
+        currentText = TextLibraryCache::GetText("drone_speed");
         descText += boost::algorithm::replace_all_copy(currentText, "\\1", std::to_string(droneSpeed)) + "\n\n";
     }
 
@@ -33,31 +33,31 @@ std::string GetWeaponStatsString(const WeaponBlueprint* bp, bool drone = false,
     {
         if (bp->power > 0)
         {
-            currentText = tLib->GetText("required_power");
+            currentText = TextLibraryCache::GetText("required_power");
             descText += boost::algorithm::replace_all_copy(currentText, "\\1", std::to_string(bp->power)) + "\n";
         }
         else if (bp->power == 0)
         {
             if (bp->cooldown >= 0)
             {
-                currentText = tLib->GetText("requires_no_power");
+                currentText = TextLibraryCache::GetText("requires_no_power");
                 descText += currentText + "\n";
             }
             else
             {
-                currentText = tLib->GetText("cannot_fire");
+                currentText = TextLibraryCache::GetText("cannot_fire");
                 descText += currentText + "\n";
             }
         }
         else
         {
-            currentText = tLib->GetText("provides_bonus_power");
+            currentText = TextLibraryCache::GetText("provides_bonus_power");
             descText += currentText + ": " + std::to_string(bp->power * -1) + "\n";
         }
 
         if (bp->cooldown >= 0)
         {
-            currentText = tLib->GetText("charge_time");
+            currentText = TextLibraryCache::GetText("charge_time");
 
             std::stringstream cooldownString;
             cooldownString << bp->cooldown;
@@ -68,7 +68,7 @@ std::string GetWeaponStatsString(const WeaponBlueprint* bp, bool drone = false,
         {
             if (bp->power != 0)
             {
-                currentText = tLib->GetText("cannot_fire");
+                currentText = TextLibraryCache::GetText("cannot_fire");
                 descText += currentText + "\n";
             }
         }
@@ -78,19 +78,19 @@ std::string GetWeaponStatsString(const WeaponBlueprint* bp, bool drone = false,
     {
         if (bp->missiles > 0)
         {
-            currentText = tLib->GetText("ammo_consumption");
+            currentText = TextLibraryCache::GetText("ammo_consumption");
             descText += boost::algorithm::replace_all_copy(currentText, "\\1", std::to_string(bp->missiles)) + "\n";
         }
 
         if (weaponDef->freeMissileChance > 0)
         {
-            currentText = tLib->GetText("free_missile_chance");
+            currentText = TextLibraryCache::GetText("free_missile_chance");
             descText += boost::algorithm::replace_all_copy(currentText, "\\1", std::to_string(weaponDef->freeMissileChance)) + "\n";
         }
 
         if (weaponDef->customDamage->accuracyMod != 0)
         {
-            currentText = tLib->GetText("accuracy_modifier");
+            currentText = TextLibraryCache::GetText("accuracy_modifier");
             descText += boost::algorithm::replace_all_copy(currentText, "\\1", std::to_string(weaponDef->customDamage->accuracyMod)) + "\n";
         }
 
@@ -102,7 +102,7 @@ std::string GetWeaponStatsString(const WeaponBlueprint* bp, bool drone = false,
             {
                 if (bp->boostPower.amount > 0)
                 {
-                    currentText = tLib->GetText("redesigned_boost_power_damage_positive");
+                    currentText = TextLibraryCache::GetText("redesigned_boost_power_damage_positive");
                     std::stringstream stream;
                     stream << std::setprecision(2) << bp->boostPower.amount;
                     boostType += boost::algorithm::replace_all_copy(currentText, "\\1", stream.str()) + "\n";
@@ -116,7 +116,7 @@ std::string GetWeaponStatsString(const WeaponBlueprint* bp, bool drone = false,
                     std::stringstream damageCapString;
                     damageCapString << (bp->boostPower.count * bp->boostPower.amount + dmg);
 
-                    currentText = tLib->GetText("redesigned_damage_cap");
+                    currentText = TextLibraryCache::GetText("redesigned_damage_cap");
                     currentText = boost::algorithm::replace_all_copy(currentText, "\\1", damageCapString.str());
                     stream.str("");
                     stream.clear();
@@ -125,7 +125,7 @@ std::string GetWeaponStatsString(const WeaponBlueprint* bp, bool drone = false,
                 }
                 else
                 {
-                    currentText = tLib->GetText("redesigned_boost_power_damage_negative");
+                    currentText = TextLibraryCache::GetText("redesigned_boost_power_damage_negative");
                     std::stringstream stream;
                     stream << std::setprecision(2) << bp->boostPower.amount;
                     boostType += boost::algorithm::replace_all_copy(currentText, "\\1", stream.str()) + "\n";
@@ -139,7 +139,7 @@ std::string GetWeaponStatsString(const WeaponBlueprint* bp, bool drone = false,
                     std::stringstream damageCapString;
                     damageCapString << (bp->boostPower.count * bp->boostPower.amount + dmg);
 
-                    currentText = tLib->GetText("redesigned_damage_cap");
+                    currentText = TextLibraryCache::GetText("redesigned_damage_cap");
                     currentText = boost::algorithm::replace_all_copy(currentText, "\\1", damageCapString.str());
                     stream.str("");
                     stream.clear();
@@ -151,7 +151,7 @@ std::string GetWeaponStatsString(const WeaponBlueprint* bp, bool drone = false,
             {
                 if (bp->boostPower.amount > 0)
                 {
-                    currentText = tLib->GetText("redesigned_boost_power_speed_positive");
+                    currentText = TextLibraryCache::GetText("redesigned_boost_power_speed_positive");
                     std::stringstream stream;
                     stream << std::setprecision(4) << bp->boostPower.amount;
                     boostType += boost::algorithm::replace_all_copy(currentText, "\\1", stream.str()) + "\n";
@@ -162,7 +162,7 @@ std::string GetWeaponStatsString(const WeaponBlueprint* bp, bool drone = false,
                         std::stringstream speedCapString;
                         speedCapString << bp->cooldown - (bp->boostPower.count * bp->boostPower.amount);
 
-                        currentText = tLib->GetText("redesigned_speed_cap");
+                        currentText = TextLibraryCache::GetText("redesigned_speed_cap");
                         currentText = boost::algorithm::replace_all_copy(currentText, "\\1", speedCapString.str());
                         stream.str("");
                         stream.clear();
@@ -174,13 +174,13 @@ std::string GetWeaponStatsString(const WeaponBlueprint* bp, bool drone = false,
                         std::stringstream maxShotCount;
                         maxShotCount << std::ceil((bp->cooldown / bp->boostPower.amount));
 
-                        currentText = tLib->GetText("max_shots");
+                        currentText = TextLibraryCache::GetText("max_shots");
                         boostType += boost::algorithm::replace_all_copy(currentText, "\\1", maxShotCount.str());
                     }
                 }
                 else
                 {
-                    currentText = tLib->GetText("redesigned_boost_power_speed_negative");
+                    currentText = TextLibraryCache::GetText("redesigned_boost_power_speed_negative");
                     std::stringstream stream;
                     stream << std::setprecision(4) << bp->boostPower.amount;
                     boostType += boost::algorithm::replace_all_copy(currentText, "\\1", stream.str()) + "\n";
@@ -188,7 +188,7 @@ std::string GetWeaponStatsString(const WeaponBlueprint* bp, bool drone = false,
                     std::stringstream speedCapString;
                     speedCapString << bp->cooldown - (bp->boostPower.count * bp->boostPower.amount);
 
-                    currentText = tLib->GetText("redesigned_speed_cap");
+                    currentText = TextLibraryCache::GetText("redesigned_speed_cap");
                     currentText = boost::algorithm::replace_all_copy(currentText, "\\1", speedCapString.str());
                     stream.str("");
                     stream.clear();
@@ -207,13 +207,13 @@ std::string GetWeaponStatsString(const WeaponBlueprint* bp, bool drone = false,
         if (weaponDef->angularRadius != -1.f) // for drones?
         {
             std::stringstream stream;
-            currentText = tLib->GetText("shot_radius_angular");
+            currentText = TextLibraryCache::GetText("shot_radius_angular");
             stream << std::fixed << std::setprecision(2) << weaponDef->angularRadius;
             descText += boost::algorithm::replace_all_copy(currentText, "\\1", stream.str()) + "\n";
         }
         else if(bp->radius > 0)
         {
-            currentText = tLib->GetText("shot_radius");
+            currentText = TextLibraryCache::GetText("shot_radius");
             descText += boost::algorithm::replace_all_copy(currentText, "\\1", std::to_string(bp->radius)) + "\n";
         }
 
@@ -223,17 +223,17 @@ std::string GetWeaponStatsString(const WeaponBlueprint* bp, bool drone = false,
             {
                 if (bp->type == 0 || bp->type == 1 || (bp->shots == 1 && bp->type != 4))
                 {
-                    currentText = tLib->GetText("shots");
+                    currentText = TextLibraryCache::GetText("shots");
                     descText += boost::algorithm::replace_all_copy(currentText, "\\1", std::to_string(bp->shots)) + "\n";
                 }
                 else if (bp->type == 3)
                 {
-                    currentText = tLib->GetText("bomb_shots");
+                    currentText = TextLibraryCache::GetText("bomb_shots");
                     descText += boost::algorithm::replace_all_copy(currentText, "\\1", std::to_string(bp->shots)) + "\n";
                 }
                 else
                 {
-                    currentText = tLib->GetText("shots");
+                    currentText = TextLibraryCache::GetText("shots");
                     descText += boost::algorithm::replace_all_copy(currentText, "\\1", std::to_string(bp->miniCount * bp->shots)) + "\n";
                 }
             }
@@ -241,22 +241,22 @@ std::string GetWeaponStatsString(const WeaponBlueprint* bp, bool drone = false,
 
         if (bp->chargeLevels > 1)
         {
-            currentText = tLib->GetText("charge");
+            currentText = TextLibraryCache::GetText("charge");
             descText += boost::algorithm::replace_all_copy(currentText, "\\1", std::to_string(bp->chargeLevels)) + "\n";
         }
 
         if (bp->type == 2)
         {
-            currentText = tLib->GetText("beam_length");
+            currentText = TextLibraryCache::GetText("beam_length");
             if (bp->length > 1)
             {
                 descText += boost::algorithm::replace_all_copy(currentText, "\\1", std::to_string(bp->length)) + "\n";
             }
             else
             {
-                descText += boost::algorithm::replace_all_copy(currentText, "\\1", tLib->GetText("pinpoint")) + "\n";
+                descText += boost::algorithm::replace_all_copy(currentText, "\\1", TextLibraryCache::GetText("pinpoint")) + "\n";
             }
-            currentText = tLib->GetText("swipe_speed");
+            currentText = TextLibraryCache::GetText("swipe_speed");
             if (bp->speed != 0)
             {
                 std::stringstream stream;
@@ -284,7 +284,7 @@ std::string GetWeaponStatsString(const WeaponBlueprint* bp, bool drone = false,
 
         if (bp->damage.bHullBuster)
         {
-            descText += tLib->GetText("redesigned_double_damage") + "\n";
+            descText += TextLibraryCache::GetText("redesigned_double_damage") + "\n";
         }
 
 //            if (bp->damage.iPersDamage == 0 && bp->damage.iSystemDamage == 0)
@@ -309,12 +309,12 @@ std::string GetWeaponStatsString(const WeaponBlueprint* bp, bool drone = false,
 //                {
                 if (bp->damage.iDamage > 0)
                 {
-                    currentText = tLib->GetText("hull_damage");
+                    currentText = TextLibraryCache::GetText("hull_damage");
                     descText += boost::algorithm::replace_all_copy(currentText, "\\1", std::to_string(bp->damage.iDamage)) + "\n";
                 }
                 else if (bp->damage.iDamage < 0)
                 {
-                    currentText = tLib->GetText("hull_damage_negative");
+                    currentText = TextLibraryCache::GetText("hull_damage_negative");
                     descText += boost::algorithm::replace_all_copy(currentText, "\\1", std::to_string(bp->damage.iDamage * -1)) + "\n";
                 }
 
@@ -327,22 +327,22 @@ std::string GetWeaponStatsString(const WeaponBlueprint* bp, bool drone = false,
 
                     if (sysDamage > 0)
                     {
-                        currentText = tLib->GetText("system_damage");
+                        currentText = TextLibraryCache::GetText("system_damage");
                         descText += boost::algorithm::replace_all_copy(currentText, "\\1", std::to_string(sysDamage)) + "\n";
                     }
                     else if (sysDamage < 0)
                     {
-                        currentText = tLib->GetText("system_damage_negative");
+                        currentText = TextLibraryCache::GetText("system_damage_negative");
                         descText += boost::algorithm::replace_all_copy(currentText, "\\1", std::to_string((sysDamage) * -1)) + "\n";
                     }
                     if (persDamage > 0)
                     {
-                        currentText = tLib->GetText("personnel_damage");
+                        currentText = TextLibraryCache::GetText("personnel_damage");
                         descText += boost::algorithm::replace_all_copy(currentText, "\\1", std::to_string((persDamage) * 15)) + "\n";
                     }
                     else if (persDamage < 0)
                     {
-                        currentText = tLib->GetText("personnel_damage_negative");
+                        currentText = TextLibraryCache::GetText("personnel_damage_negative");
                         descText += boost::algorithm::replace_all_copy(currentText, "\\1", std::to_string(((persDamage) * -1) * 15)) + "\n";
                     }
 
@@ -351,22 +351,22 @@ std::string GetWeaponStatsString(const WeaponBlueprint* bp, bool drone = false,
                 {
                     if (bp->damage.iSystemDamage > 0)
                     {
-                        currentText = tLib->GetText("system_damage");
+                        currentText = TextLibraryCache::GetText("system_damage");
                         descText += boost::algorithm::replace_all_copy(currentText, "\\1", std::to_string(bp->damage.iSystemDamage)) + "\n";
                     }
                     else if (bp->damage.iSystemDamage < 0)
                     {
-                        currentText = tLib->GetText("system_damage_negative");
+                        currentText = TextLibraryCache::GetText("system_damage_negative");
                         descText += boost::algorithm::replace_all_copy(currentText, "\\1", std::to_string((bp->damage.iSystemDamage) * -1)) + "\n";
                     }
                     if (bp->damage.iPersDamage > 0)
                     {
-                        currentText = tLib->GetText("personnel_damage");
+                        currentText = TextLibraryCache::GetText("personnel_damage");
                         descText += boost::algorithm::replace_all_copy(currentText, "\\1", std::to_string((bp->damage.iPersDamage) * 15)) + "\n";
                     }
                     else if (bp->damage.iPersDamage < 0)
                     {
-                        currentText = tLib->GetText("personnel_damage_negative");
+                        currentText = TextLibraryCache::GetText("personnel_damage_negative");
                         descText += boost::algorithm::replace_all_copy(currentText, "\\1", std::to_string(((bp->damage.iPersDamage) * -1) * 15)) + "\n";
                     }
                 }
@@ -393,13 +393,13 @@ std::string GetWeaponStatsString(const WeaponBlueprint* bp, bool drone = false,
 
         if (bp->damage.iIonDamage != 0)
         {
-            currentText = tLib->GetText("ion_damage");
+            currentText = TextLibraryCache::GetText("ion_damage");
             descText += boost::algorithm::replace_all_copy(currentText, "\\1", std::to_string(bp->damage.iIonDamage)) + "\n";
         }
 
         if (bp->damage.iShieldPiercing != 0)
         {
-            currentText = tLib->GetText("shield_piercing");
+            currentText = TextLibraryCache::GetText("shield_piercing");
             if (bp->type != 2 || bp->damage.iDamage > 0)
             {
                 descText += boost::algorithm::replace_all_copy(currentText, "\\1", std::to_string(bp->damage.iShieldPiercing)) + "\n";
@@ -421,22 +421,22 @@ std::string GetWeaponStatsString(const WeaponBlueprint* bp, bool drone = false,
 
         if (bp->damage.bLockdown)
         {
-            currentText = tLib->GetText("weapon_lockdown");
+            currentText = TextLibraryCache::GetText("weapon_lockdown");
             descText += currentText + "\n";
         }
         if (bp->damage.fireChance > 0)
         {
-            currentText = tLib->GetText("fire_chance");
+            currentText = TextLibraryCache::GetText("fire_chance");
             boost::algorithm::replace_all(currentText, "\\1", std::to_string(bp->damage.fireChance * 10));
 
-            std::string level = tLib->GetText("chance_low");
+            std::string level = TextLibraryCache::GetText("chance_low");
             if (bp->damage.fireChance >= 7)
             {
-                level = tLib->GetText("chance_high");
+                level = TextLibraryCache::GetText("chance_high");
             }
             else if (bp->damage.fireChance >= 4)
             {
-                level = tLib->GetText("chance_medium");
+                level = TextLibraryCache::GetText("chance_medium");
             }
 
             boost::algorithm::replace_all(currentText, "\\2", level);
@@ -446,18 +446,18 @@ std::string GetWeaponStatsString(const WeaponBlueprint* bp, bool drone = false,
         }
         if (bp->damage.breachChance > 0)
         {
-            currentText = tLib->GetText("breach_chance");
+            currentText = TextLibraryCache::GetText("breach_chance");
             boost::algorithm::replace_all(currentText, "\\1", std::to_string(bp->damage.breachChance * 10));
             boost::algorithm::replace_all(currentText, "\\2", std::to_string(bp->damage.breachChance * 10 - bp->damage.fireChance * bp->damage.breachChance));
 
-            std::string level = tLib->GetText("chance_low");
+            std::string level = TextLibraryCache::GetText("chance_low");
             if (bp->damage.breachChance >= 7)
             {
-                level = tLib->GetText("chance_high");
+                level = TextLibraryCache::GetText("chance_high");
             }
             else if (bp->damage.breachChance >= 4)
             {
-                level = tLib->GetText("chance_medium");
+                level = TextLibraryCache::GetText("chance_medium");
             }
 
             boost::algorithm::replace_all(currentText, "\\3", level);
@@ -466,24 +466,24 @@ std::string GetWeaponStatsString(const WeaponBlueprint* bp, bool drone = false,
         }
         if (bp->damage.iStun > 0 && Settings::GetDlcEnabled())
         {
-            currentText = tLib->GetText("stun_chance");
+            currentText = TextLibraryCache::GetText("stun_chance");
             boost::algorithm::replace_all(currentText, "\\1", std::to_string(100));
-            descText += currentText + " (" + std::to_string(bp->damage.iStun) + " " + tLib->GetText("stun_length") + ")\n";
+            descText += currentText + " (" + std::to_string(bp->damage.iStun) + " " + TextLibraryCache::GetText("stun_length") + ")\n";
         }
         else if (bp->damage.stunChance > 0 && Settings::GetDlcEnabled())
         {
-            currentText = tLib->GetText("stun_chance");
+            currentText = TextLibraryCache::GetText("stun_chance");
             boost::algorithm::replace_all(currentText, "\\1", std::to_string(bp->damage.stunChance * 10));
-            currentText += " (3 " + tLib->GetText("stun_length") + ")";
+            currentText += " (3 " + TextLibraryCache::GetText("stun_length") + ")";
 
-            std::string level = tLib->GetText("chance_low") + " (3 " + tLib->GetText("stun_length");
+            std::string level = TextLibraryCache::GetText("chance_low") + " (3 " + TextLibraryCache::GetText("stun_length");
             if (bp->damage.stunChance >= 7)
             {
-                level = tLib->GetText("chance_high") + " (3 " + tLib->GetText("stun_length");
+                level = TextLibraryCache::GetText("chance_high") + " (3 " + TextLibraryCache::GetText("stun_length");
             }
             else if (bp->damage.stunChance >= 4)
             {
-                level = tLib->GetText("chance_medium") + " (3 " + tLib->GetText("stun_length");
+                level = TextLibraryCache::GetText("chance_medium") + " (3 " + TextLibraryCache::GetText("stun_length");
             }
 
             boost::algorithm::replace_all(currentText, "\\2", level);
@@ -492,24 +492,24 @@ std::string GetWeaponStatsString(const WeaponBlueprint* bp, bool drone = false,
         }
         if (weaponDef->customDamage->erosionChance > 0)
         {
-            currentText = tLib->GetText("erosion_chance");
+            currentText = TextLibraryCache::GetText("erosion_chance");
             boost::algorithm::replace_all(currentText, "\\1", std::to_string(weaponDef->customDamage->erosionChance * 10));
 
-            std::string level = tLib->GetText("chance_low");
+            std::string level = TextLibraryCache::GetText("chance_low");
             if (weaponDef->customDamage->erosionChance >= 7)
             {
-                level = tLib->GetText("chance_high");
+                level = TextLibraryCache::GetText("chance_high");
             }
             else if (weaponDef->customDamage->erosionChance >= 4)
             {
-                level = tLib->GetText("chance_medium");
+                level = TextLibraryCache::GetText("chance_medium");
             }
 
             boost::algorithm::replace_all(currentText, "\\2", level);
 
             descText += currentText + "\n";
 
-            currentText = tLib->GetText("erosion_effect");
+            currentText = TextLibraryCache::GetText("erosion_effect");
 
             std::stringstream stream;
             stream << std::setprecision(2) << weaponDef->customDamage->erosionEffect.erosionSpeed * weaponDef->customDamage->erosionEffect.erosionTime * 0.16f;
@@ -527,17 +527,17 @@ std::string GetWeaponStatsString(const WeaponBlueprint* bp, bool drone = false,
         }
         if (weaponDef->customDamage->statBoostChance > 0)
         {
-            currentText = tLib->GetText("crew_statboost_chance");
+            currentText = TextLibraryCache::GetText("crew_statboost_chance");
             boost::algorithm::replace_all(currentText, "\\1", std::to_string(weaponDef->customDamage->statBoostChance * 10));
 
-            std::string level = tLib->GetText("chance_low");
+            std::string level = TextLibraryCache::GetText("chance_low");
             if (weaponDef->customDamage->statBoostChance >= 7)
             {
-                level = tLib->GetText("chance_high");
+                level = TextLibraryCache::GetText("chance_high");
             }
             else if (weaponDef->customDamage->statBoostChance >= 4)
             {
-                level = tLib->GetText("chance_medium");
+                level = TextLibraryCache::GetText("chance_medium");
             }
 
             boost::algorithm::replace_all(currentText, "\\2", level);
@@ -546,17 +546,17 @@ std::string GetWeaponStatsString(const WeaponBlueprint* bp, bool drone = false,
         }
         if (weaponDef->customDamage->roomStatBoostChance > 0)
         {
-            currentText = tLib->GetText("room_statboost_chance");
+            currentText = TextLibraryCache::GetText("room_statboost_chance");
             boost::algorithm::replace_all(currentText, "\\1", std::to_string(weaponDef->customDamage->roomStatBoostChance * 10));
 
-            std::string level = tLib->GetText("chance_low");
+            std::string level = TextLibraryCache::GetText("chance_low");
             if (weaponDef->customDamage->roomStatBoostChance >= 7)
             {
-                level = tLib->GetText("chance_high");
+                level = TextLibraryCache::GetText("chance_high");
             }
             else if (weaponDef->customDamage->roomStatBoostChance >= 4)
             {
-                level = tLib->GetText("chance_medium");
+                level = TextLibraryCache::GetText("chance_medium");
             }
 
             boost::algorithm::replace_all(currentText, "\\2", level);
@@ -565,17 +565,17 @@ std::string GetWeaponStatsString(const WeaponBlueprint* bp, bool drone = false,
         }
         if (weaponDef->customDamage->crewSpawnChance > 0)
         {
-            currentText = tLib->GetText("crew_spawn_chance");
+            currentText = TextLibraryCache::GetText("crew_spawn_chance");
             boost::algorithm::replace_all(currentText, "\\1", std::to_string(weaponDef->customDamage->crewSpawnChance * 10));
 
-            std::string level = tLib->GetText("chance_low");
+            std::string level = TextLibraryCache::GetText("chance_low");
             if (weaponDef->customDamage->crewSpawnChance >= 7)
             {
-                level = tLib->GetText("chance_high");
+                level = TextLibraryCache::GetText("chance_high");
             }
             else if (weaponDef->customDamage->crewSpawnChance >= 4)
             {
-                level = tLib->GetText("chance_medium");
+                level = TextLibraryCache::GetText("chance_medium");
             }
 
             boost::algorithm::replace_all(currentText, "\\2", level);
@@ -602,7 +602,6 @@ HOOK_METHOD(WeaponBox, GenerateTooltip, () -> std::string)
     LOG_HOOK("HOOK_METHOD -> WeaponBox::GenerateTooltip -> Begin (RedesignedTooltips.cpp)\n")
     std::string ret = super();
 
-    auto tLib = G_->GetTextLibrary();
     std::string descText = "";
     std::string currentText = "";
     auto bp = this->pWeapon->blueprint;
@@ -637,7 +636,6 @@ HOOK_METHOD(WeaponBlueprint, GetDescription, (bool tooltip) -> std::string)
     if (tooltip || this->name.empty()) return super(tooltip);
     std::string ret = super(tooltip);
 
-    auto tLib = G_->GetTextLibrary();
     std::string descText = "";
     std::string currentText = "";
 
@@ -658,10 +656,10 @@ HOOK_METHOD(WeaponBlueprint, GetDescription, (bool tooltip) -> std::string)
     else if (CustomOptionsManager::GetInstance()->redesignedWeaponTooltips.currentValue)
     {
         descText += this->desc.description.GetText() + "\n\n";
-        descText += tLib->GetText("description_stats") + "\n";
+        descText += TextLibraryCache::GetText("description_stats") + "\n";
         descText += GetWeaponStatsString(this);
         descText += "\n\n";
-        currentText = G_->GetTextLibrary()->GetText("scrap_value");
+        currentText = TextLibraryCache::GetText("scrap_value");
         currentText = boost::algorithm::replace_all_copy(currentText, "\\1", std::to_string(this->desc.cost));
         descText += boost::algorithm::replace_all_copy(currentText, "\\2", std::to_string(this->desc.cost / 2));
         descText += "\n";
@@ -671,10 +669,10 @@ HOOK_METHOD(WeaponBlueprint, GetDescription, (bool tooltip) -> std::string)
     {
         descText += this->desc.description.GetText() + "\n\n";
 
-        currentText = tLib->GetText("required_power");
+        currentText = TextLibraryCache::GetText("required_power");
         descText += boost::algorithm::replace_all_copy(currentText, "\\1", std::to_string(this->power)) + "\n";
 
-        currentText = tLib->GetText("charge_time");
+        currentText = TextLibraryCache::GetText("charge_time");
 
         std::stringstream cooldownString;
         cooldownString << this->cooldown;
@@ -688,7 +686,7 @@ HOOK_METHOD(WeaponBlueprint, GetDescription, (bool tooltip) -> std::string)
 
             if (this->boostPower.type == 2)
             {
-                boostType += tLib->GetText("boost_power_damage") + "\n";
+                boostType += TextLibraryCache::GetText("boost_power_damage") + "\n";
 
                 int dmg = this->damage.iIonDamage;
                 if (dmg <= 0)
@@ -699,14 +697,14 @@ HOOK_METHOD(WeaponBlueprint, GetDescription, (bool tooltip) -> std::string)
                 std::stringstream damageCapString;
                 damageCapString << (this->boostPower.count * this->boostPower.amount + dmg);
 
-                currentText = tLib->GetText("damage_cap");
+                currentText = TextLibraryCache::GetText("damage_cap");
                 boostType += boost::algorithm::replace_all_copy(currentText, "\\1", damageCapString.str()) + "\n";
             }
             else
             {
-                boostType += tLib->GetText("boost_power_speed") + "\n";
+                boostType += TextLibraryCache::GetText("boost_power_speed") + "\n";
 
-                currentText = tLib->GetText("speed_cap");
+                currentText = TextLibraryCache::GetText("speed_cap");
 
                 std::stringstream speedCapString;
                 speedCapString << this->cooldown - (this->boostPower.count * this->boostPower.amount);
@@ -719,57 +717,57 @@ HOOK_METHOD(WeaponBlueprint, GetDescription, (bool tooltip) -> std::string)
 
         if (this->missiles > 0)
         {
-            descText += tLib->GetText("requires_missiles") + "\n";
+            descText += TextLibraryCache::GetText("requires_missiles") + "\n";
         }
 
         if ((this->type == 0 || this->type == 1) && this->shots > 0)
         {
-            currentText = tLib->GetText("shots");
+            currentText = TextLibraryCache::GetText("shots");
             descText += boost::algorithm::replace_all_copy(currentText, "\\1", std::to_string(this->shots)) + "\n";
         }
 
         if (this->type == 4)
         {
-            currentText = tLib->GetText("shots");
+            currentText = TextLibraryCache::GetText("shots");
             descText += boost::algorithm::replace_all_copy(currentText, "\\1", std::to_string(this->miniCount)) + "\n";
         }
 
         if (this->chargeLevels > 1)
         {
-            currentText = tLib->GetText("charge");
+            currentText = TextLibraryCache::GetText("charge");
             descText += boost::algorithm::replace_all_copy(currentText, "\\1", std::to_string(this->chargeLevels)) + "\n";
         }
 
         if (this->type == 2)
         {
-            currentText = tLib->GetText("damage_room");
+            currentText = TextLibraryCache::GetText("damage_room");
             descText += boost::algorithm::replace_all_copy(currentText, "\\1", std::to_string(this->damage.iDamage)) + "\n";
         }
         else
         {
-            currentText = tLib->GetText("damage_shot");
+            currentText = TextLibraryCache::GetText("damage_shot");
             descText += boost::algorithm::replace_all_copy(currentText, "\\1", std::to_string(this->damage.iDamage)) + "\n";
         }
 
         if (this->damage.iShieldPiercing != 0)
         {
-            currentText = tLib->GetText("shield_piercing");
+            currentText = TextLibraryCache::GetText("shield_piercing");
             descText += boost::algorithm::replace_all_copy(currentText, "\\1", std::to_string(this->damage.iShieldPiercing)) + "\n";
         }
 
         if (this->damage.fireChance > 0)
         {
-            currentText = tLib->GetText("fire_chance");
+            currentText = TextLibraryCache::GetText("fire_chance");
             boost::algorithm::replace_all(currentText, "\\1", std::to_string(this->damage.fireChance * 10));
 
-            std::string level = tLib->GetText("chance_low");
+            std::string level = TextLibraryCache::GetText("chance_low");
             if (this->damage.fireChance >= 7)
             {
-                level = tLib->GetText("chance_high");
+                level = TextLibraryCache::GetText("chance_high");
             }
             else if (this->damage.fireChance >= 4)
             {
-                level = tLib->GetText("chance_medium");
+                level = TextLibraryCache::GetText("chance_medium");
             }
 
             boost::algorithm::replace_all(currentText, "\\2", level);
@@ -779,18 +777,18 @@ HOOK_METHOD(WeaponBlueprint, GetDescription, (bool tooltip) -> std::string)
         }
         if (this->damage.breachChance > 0)
         {
-            currentText = tLib->GetText("breach_chance");
+            currentText = TextLibraryCache::GetText("breach_chance");
             boost::algorithm::replace_all(currentText, "\\1", std::to_string(this->damage.breachChance * 10));
             boost::algorithm::replace_all(currentText, "\\2", std::to_string(this->damage.breachChance * 10 - this->damage.fireChance * this->damage.breachChance));
 
-            std::string level = tLib->GetText("chance_low");
+            std::string level = TextLibraryCache::GetText("chance_low");
             if (this->damage.breachChance >= 7)
             {
-                level = tLib->GetText("chance_high");
+                level = TextLibraryCache::GetText("chance_high");
             }
             else if (this->damage.breachChance >= 4)
             {
-                level = tLib->GetText("chance_medium");
+                level = TextLibraryCache::GetText("chance_medium");
             }
 
             boost::algorithm::replace_all(currentText, "\\3", level);
@@ -800,27 +798,27 @@ HOOK_METHOD(WeaponBlueprint, GetDescription, (bool tooltip) -> std::string)
 
         if (this->damage.iIonDamage != 0)
         {
-            currentText = tLib->GetText("ion_damage");
+            currentText = TextLibraryCache::GetText("ion_damage");
             descText += boost::algorithm::replace_all_copy(currentText, "\\1", std::to_string(this->damage.iIonDamage)) + "\n";
         }
         if (this->damage.iStun > 0 && Settings::GetDlcEnabled())
         {
-            currentText = tLib->GetText("stun_damage");
+            currentText = TextLibraryCache::GetText("stun_damage");
             descText += boost::algorithm::replace_all_copy(currentText, "\\1", std::to_string(this->damage.iStun)) + "\n";
         }
         else if (this->damage.stunChance > 0 && Settings::GetDlcEnabled())
         {
-            currentText = tLib->GetText("stun_chance");
+            currentText = TextLibraryCache::GetText("stun_chance");
             boost::algorithm::replace_all(currentText, "\\1", std::to_string(this->damage.stunChance * 10));
 
-            std::string level = tLib->GetText("chance_low");
+            std::string level = TextLibraryCache::GetText("chance_low");
             if (this->damage.stunChance >= 7)
             {
-                level = tLib->GetText("chance_high");
+                level = TextLibraryCache::GetText("chance_high");
             }
             else if (this->damage.stunChance >= 4)
             {
-                level = tLib->GetText("chance_medium");
+                level = TextLibraryCache::GetText("chance_medium");
             }
 
             boost::algorithm::replace_all(currentText, "\\2", level);
@@ -829,24 +827,24 @@ HOOK_METHOD(WeaponBlueprint, GetDescription, (bool tooltip) -> std::string)
         }
         if (weaponDef->customDamage->erosionChance > 0)
         {
-            currentText = tLib->GetText("erosion_chance");
+            currentText = TextLibraryCache::GetText("erosion_chance");
             boost::algorithm::replace_all(currentText, "\\1", std::to_string(weaponDef->customDamage->erosionChance * 10));
 
-            std::string level = tLib->GetText("chance_low");
+            std::string level = TextLibraryCache::GetText("chance_low");
             if (weaponDef->customDamage->erosionChance >= 7)
             {
-                level = tLib->GetText("chance_high");
+                level = TextLibraryCache::GetText("chance_high");
             }
             else if (weaponDef->customDamage->erosionChance >= 4)
             {
-                level = tLib->GetText("chance_medium");
+                level = TextLibraryCache::GetText("chance_medium");
             }
 
             boost::algorithm::replace_all(currentText, "\\2", level);
 
             descText += currentText + "\n";
 
-            currentText = tLib->GetText("erosion_effect");
+            currentText = TextLibraryCache::GetText("erosion_effect");
 
             std::stringstream stream;
             stream << std::setprecision(2) << weaponDef->customDamage->erosionEffect.erosionSpeed * weaponDef->customDamage->erosionEffect.erosionTime * 0.16f;
@@ -864,17 +862,17 @@ HOOK_METHOD(WeaponBlueprint, GetDescription, (bool tooltip) -> std::string)
         }
         if (weaponDef->customDamage->statBoostChance > 0)
         {
-            currentText = tLib->GetText("crew_statboost_chance");
+            currentText = TextLibraryCache::GetText("crew_statboost_chance");
             boost::algorithm::replace_all(currentText, "\\1", std::to_string(weaponDef->customDamage->statBoostChance * 10));
 
-            std::string level = tLib->GetText("chance_low");
+            std::string level = TextLibraryCache::GetText("chance_low");
             if (weaponDef->customDamage->statBoostChance >= 7)
             {
-                level = tLib->GetText("chance_high");
+                level = TextLibraryCache::GetText("chance_high");
             }
             else if (weaponDef->customDamage->statBoostChance >= 4)
             {
-                level = tLib->GetText("chance_medium");
+                level = TextLibraryCache::GetText("chance_medium");
             }
 
             boost::algorithm::replace_all(currentText, "\\2", level);
@@ -883,17 +881,17 @@ HOOK_METHOD(WeaponBlueprint, GetDescription, (bool tooltip) -> std::string)
         }
         if (weaponDef->customDamage->roomStatBoostChance > 0)
         {
-            currentText = tLib->GetText("room_statboost_chance");
+            currentText = TextLibraryCache::GetText("room_statboost_chance");
             boost::algorithm::replace_all(currentText, "\\1", std::to_string(weaponDef->customDamage->roomStatBoostChance * 10));
 
-            std::string level = tLib->GetText("chance_low");
+            std::string level = TextLibraryCache::GetText("chance_low");
             if (weaponDef->customDamage->roomStatBoostChance >= 7)
             {
-                level = tLib->GetText("chance_high");
+                level = TextLibraryCache::GetText("chance_high");
             }
             else if (weaponDef->customDamage->roomStatBoostChance >= 4)
             {
-                level = tLib->GetText("chance_medium");
+                level = TextLibraryCache::GetText("chance_medium");
             }
 
             boost::algorithm::replace_all(currentText, "\\2", level);
@@ -902,17 +900,17 @@ HOOK_METHOD(WeaponBlueprint, GetDescription, (bool tooltip) -> std::string)
         }
         if (weaponDef->customDamage->crewSpawnChance > 0)
         {
-            currentText = tLib->GetText("crew_spawn_chance");
+            currentText = TextLibraryCache::GetText("crew_spawn_chance");
             boost::algorithm::replace_all(currentText, "\\1", std::to_string(weaponDef->customDamage->crewSpawnChance * 10));
 
-            std::string level = tLib->GetText("chance_low");
+            std::string level = TextLibraryCache::GetText("chance_low");
             if (weaponDef->customDamage->crewSpawnChance >= 7)
             {
-                level = tLib->GetText("chance_high");
+                level = TextLibraryCache::GetText("chance_high");
             }
             else if (weaponDef->customDamage->crewSpawnChance >= 4)
             {
-                level = tLib->GetText("chance_medium");
+                level = TextLibraryCache::GetText("chance_medium");
             }
 
             boost::algorithm::replace_all(currentText, "\\2", level);
@@ -923,28 +921,28 @@ HOOK_METHOD(WeaponBlueprint, GetDescription, (bool tooltip) -> std::string)
         if (weaponDef->customDamage->noPersDamage) persDamage -= this->damage.iDamage;
         if (persDamage != 0)
         {
-            currentText = tLib->GetText("personnel_damage");
+            currentText = TextLibraryCache::GetText("personnel_damage");
             descText += boost::algorithm::replace_all_copy(currentText, "\\1", std::to_string(persDamage * 15)) + "\n";
         }
         int sysDamage = this->damage.iSystemDamage;
         if (weaponDef->customDamage->noSysDamage) sysDamage -= this->damage.iDamage;
         if (sysDamage != 0)
         {
-            currentText = tLib->GetText("system_damage");
+            currentText = TextLibraryCache::GetText("system_damage");
             descText += boost::algorithm::replace_all_copy(currentText, "\\1", std::to_string(sysDamage)) + "\n";
         }
         if (this->damage.bHullBuster)
         {
-            descText += tLib->GetText("double_damage") + "\n";
+            descText += TextLibraryCache::GetText("double_damage") + "\n";
         }
         if (weaponDef->freeMissileChance > 0)
         {
-            currentText = tLib->GetText("free_missile_chance");
+            currentText = TextLibraryCache::GetText("free_missile_chance");
             descText += boost::algorithm::replace_all_copy(currentText, "\\1", std::to_string(weaponDef->freeMissileChance)) + "\n";
         }
         if (weaponDef->customDamage->accuracyMod != 0)
         {
-            currentText = tLib->GetText("accuracy_modifier");
+            currentText = TextLibraryCache::GetText("accuracy_modifier");
             descText += boost::algorithm::replace_all_copy(currentText, "\\1", std::to_string(weaponDef->customDamage->accuracyMod)) + "\n";
         }
         ret.assign(descText);
@@ -982,7 +980,7 @@ HOOK_METHOD(InfoBox, SetBlueprintAugment, (const AugmentBlueprint* bp) -> void)
         newDesc = bp->desc.description.data;
     }
     newDesc += "\n\n";
-    std::string currentText = G_->GetTextLibrary()->GetText("scrap_value");
+    std::string currentText = TextLibraryCache::GetText("scrap_value");
     currentText = boost::algorithm::replace_all_copy(currentText, "\\1", std::to_string(bp->desc.cost));
     newDesc += boost::algorithm::replace_all_copy(currentText, "\\2", std::to_string(bp->desc.cost / 2));
 
@@ -1011,7 +1009,7 @@ HOOK_METHOD(InfoBox, SetBlueprintAugment, (const AugmentBlueprint* bp) -> void)
 
     if (customAug->IsAugment(bp->name))
     {
-        std::string warn = G_->GetTextLibrary()->GetText("augment_no_effect");
+        std::string warn = TextLibraryCache::GetText("augment_no_effect");
         warn.append("\n");
 
         BlueprintManager* blueprints = G_->GetBlueprints();
@@ -1136,9 +1134,10 @@ HOOK_METHOD(TextLibrary, GetText, (const std::string& name, const std::string& l
 {
     LOG_HOOK("HOOK_METHOD -> TextLibrary::GetText -> Begin (RedesignedTooltips.cpp)\n")
 
-    if (g_emptyDroneStatText && (name == "required_power" || name == "drone_required"))
+    if (name == "required_power" || name == "drone_required")
     {
-        return "";
+        TextLibraryCache::MarkVolatile();
+        if (g_emptyDroneStatText) return "";
     }
     return super(name, lang);
 }
@@ -1163,8 +1162,7 @@ HOOK_METHOD(InfoBox, SetBlueprintDrone, (const DroneBlueprint* bp, int status, b
         {
             auto droneBp = G_->GetBlueprints()->GetWeaponBlueprint(bp->weaponBlueprint);
             auto weaponDef = CustomWeaponManager::instance->GetWeaponDefinition(droneBp->name);
-            auto tLib = G_->GetTextLibrary();
-
+        
             if (bp->typeName == "COMBAT")
             {
                 newDesc += GetWeaponStatsString(droneBp, true, bp->power, bp->speed);
@@ -1172,41 +1170,41 @@ HOOK_METHOD(InfoBox, SetBlueprintDrone, (const DroneBlueprint* bp, int status, b
             else
             {
                 newDesc += "\n\n";
-                newDesc += tLib->GetText("description_stats") + "\n";
-                currentText = G_->GetTextLibrary()->GetText("required_power");
+                newDesc += TextLibraryCache::GetText("description_stats") + "\n";
+                currentText = TextLibraryCache::GetText("required_power");
                 newDesc += boost::algorithm::replace_all_copy(currentText, "\\1", std::to_string(bp->power)) + "\n";
-                newDesc += G_->GetTextLibrary()->GetText("drone_required") + "\n\n";
+                newDesc += TextLibraryCache::GetText("drone_required") + "\n\n";
                 switch (bp->targetType)
                 {
                 case 1:
-                    currentText = tLib->GetText("defense_drone_projectile_target_solid");
+                    currentText = TextLibraryCache::GetText("defense_drone_projectile_target_solid");
                     break;
                 case 2:
-                    currentText = tLib->GetText("defense_drone_projectile_target_asteroid");
+                    currentText = TextLibraryCache::GetText("defense_drone_projectile_target_asteroid");
                     break;
                 case 3:
-                    currentText = tLib->GetText("defense_drone_drone_target_all");
+                    currentText = TextLibraryCache::GetText("defense_drone_drone_target_all");
                     break;
                 case 4:
-                    currentText = tLib->GetText("defense_drone_projectile_target_all");
+                    currentText = TextLibraryCache::GetText("defense_drone_projectile_target_all");
                     break;
                 case 5:
-                    currentText = tLib->GetText("defense_drone_drone_target_solid_projectiles");
+                    currentText = TextLibraryCache::GetText("defense_drone_drone_target_solid_projectiles");
                     break;
                 case 6:
-                    currentText = tLib->GetText("defense_drone_drone_target_all_projectiles");
+                    currentText = TextLibraryCache::GetText("defense_drone_drone_target_all_projectiles");
                     break;
                 default:
-                    currentText = tLib->GetText("defense_drone_projectile_target_unknown");
+                    currentText = TextLibraryCache::GetText("defense_drone_projectile_target_unknown");
                 }
                 newDesc += currentText + "\n";
-                currentText = tLib->GetText("defense_drone_reload_speed");
+                currentText = TextLibraryCache::GetText("defense_drone_reload_speed");
                 std::stringstream stream;
                 stream << std::fixed << std::setprecision(0) << bp->cooldown * 1000;
                 newDesc += boost::algorithm::replace_all_copy(currentText, "\\1", stream.str()) + "\n";
 
                 stream.str("");
-                currentText = tLib->GetText("defense_drone_projectile_speed");
+                currentText = TextLibraryCache::GetText("defense_drone_projectile_speed");
                 if (droneBp->speed != 0)
                 {
                     stream << std::fixed << std::setprecision(0) << droneBp->speed;
@@ -1221,12 +1219,12 @@ HOOK_METHOD(InfoBox, SetBlueprintDrone, (const DroneBlueprint* bp, int status, b
                 if ((bp->targetType == 3) &&
                     weaponDef->customDamage->droneAccuracyMod != 0)
                 {
-                    currentText = tLib->GetText("accuracy_modifier");
+                    currentText = TextLibraryCache::GetText("accuracy_modifier");
                     newDesc += boost::algorithm::replace_all_copy(currentText, "\\1", std::to_string(weaponDef->customDamage->droneAccuracyMod)) + "\n";
                 }
 
                 stream.str("");
-                currentText = tLib->GetText("defense_drone_orbit_speed");
+                currentText = TextLibraryCache::GetText("defense_drone_orbit_speed");
                 stream << std::fixed << std::setprecision(0) << bp->speed;
                 newDesc += boost::algorithm::replace_all_copy(currentText, "\\1", stream.str());
                 if (droneBp->type == 4)
@@ -1235,16 +1233,16 @@ HOOK_METHOD(InfoBox, SetBlueprintDrone, (const DroneBlueprint* bp, int status, b
                     if (weaponDef->angularRadius != -1.f)
                     {
                         stream.str("");
-                        currentText = tLib->GetText("shot_radius_angular");
+                        currentText = TextLibraryCache::GetText("shot_radius_angular");
                         stream << std::fixed << std::setprecision(2) << weaponDef->angularRadius;
                         newDesc += boost::algorithm::replace_all_copy(currentText, "\\1", stream.str()) + "\n";
                     }
                     else if (droneBp->radius > 0)
                     {
-                        currentText = tLib->GetText("shot_radius");
+                        currentText = TextLibraryCache::GetText("shot_radius");
                         newDesc += boost::algorithm::replace_all_copy(currentText, "\\1", std::to_string(droneBp->radius)) + "\n";
                     }
-                    currentText = tLib->GetText("shots");
+                    currentText = TextLibraryCache::GetText("shots");
                     newDesc += boost::algorithm::replace_all_copy(currentText, "\\1", std::to_string(droneBp->miniCount));
                 }
             }
@@ -1252,14 +1250,14 @@ HOOK_METHOD(InfoBox, SetBlueprintDrone, (const DroneBlueprint* bp, int status, b
         else
         {
             newDesc += "\n\n";
-            newDesc += G_->GetTextLibrary()->GetText("description_stats") + "\n";
-            currentText = G_->GetTextLibrary()->GetText("required_power");
+            newDesc += TextLibraryCache::GetText("description_stats") + "\n";
+            currentText = TextLibraryCache::GetText("required_power");
             newDesc += boost::algorithm::replace_all_copy(currentText, "\\1", std::to_string(bp->power)) + "\n";
-            newDesc += G_->GetTextLibrary()->GetText("drone_required");
+            newDesc += TextLibraryCache::GetText("drone_required");
         }
 
         newDesc += "\n\n";
-        currentText = G_->GetTextLibrary()->GetText("scrap_value");
+        currentText = TextLibraryCache::GetText("scrap_value");
         currentText = boost::algorithm::replace_all_copy(currentText, "\\1", std::to_string(bp->desc.cost));
         newDesc += boost::algorithm::replace_all_copy(currentText, "\\2", std::to_string(bp->desc.cost / 2));
 
@@ -36,6 +36,8 @@
 #include "HSVersion.h"
 #include "CustomUpgrades.h"
 #include "RoamingShip.h"
+#include "XMLTag.h"
+#include "XMLValue.h"
 
 #include <boost/lexical_cast.hpp>
 #include <boost/algorithm/string/replace.hpp>
@@ -43,10 +45,10 @@
 
 GL_Color& ParseColorNode(GL_Color& colorRef, rapidxml::xml_node<char>* node, bool divide)
 {
-    if (node->first_attribute("r")) { colorRef.r = boost::lexical_cast<float>(node->first_attribute("r")->value()) / (divide ? 255.f : 1.f); }
-    if (node->first_attribute("g")) { colorRef.g = boost::lexical_cast<float>(node->first_attribute("g")->value()) / (divide ? 255.f : 1.f); }
-    if (node->first_attribute("b")) { colorRef.b = boost::lexical_cast<float>(node->first_attribute("b")->value()) / (divide ? 255.f : 1.f); }
-    if (node->first_attribute("a")) { colorRef.a = boost::lexical_cast<float>(node->first_attribute("a")->value()); }
+    if (node->first_attribute("r")) { colorRef.r = XMLValue::Attribute<float>(node, "r") / (divide ? 255.f : 1.f); }
+    if (node->first_attribute("g")) { colorRef.g = XMLValue::Attribute<float>(node, "g") / (divide ? 255.f : 1.f); }
+    if (node->first_attribute("b")) { colorRef.b = XMLValue::Attribute<float>(node, "b") / (divide ? 255.f : 1.f); }
+    if (node->first_attribute("a")) { colorRef.a = XMLValue::Attribute<float>(node, "a"); }
 
     return colorRef;
 }
@@ -65,13 +67,16 @@ HOOK_METHOD(ResourceControl, PreloadResources, (bool unk) -> bool)
     list_files_start(this->package);
     bool mvDetected = false;
     bool hsDetected = false;
+    static const char mvPrefix[] = "audio/music/mv_MUS_";
     for(char* pkgFile; pkgFile = list_files_next(this->package), pkgFile != (char*) 0x0;)
     {
-        if(!mvDetected && strstr(pkgFile, "audio/music/mv_MUS_") == pkgFile)
+        // prefix compare so non-matching paths are rejected at the first differing character
+        if(!mvDetected && strncmp(pkgFile, mvPrefix, sizeof(mvPrefix) - 1) == 0)
             mvDetected = true;
         else if(!hsDetected && strcmp(pkgFile, "example_layout_syntax.xml") == 0)
             hsDetected = true;
-        else if(hsDetected && mvDetected)
+
+        if(hsDetected && mvDetected)
             break;
     }
     printf("ftl.dat scan detection: Hyperspace.ftl: %s, Multiverse.zip: %s\n", hsDetected ? "YES" : "NO", mvDetected ? "YES" : "NO");
@@ -135,7 +140,7 @@ void Global::PreInitializeResources(ResourceControl *resources)
                 if(versionStr.find('.') == std::string::npos)
                 {
                     hs_log_file("Old version check in use. Mod authors please update your hyperspace.xml's version tag!\n");
-                    checkedVersion = boost::lexical_cast<int>(node->value()) == HS_Version.getDeprecatedIntegerVersion();
+                    checkedVersion = XMLValue::Value<int>(node) == HS_Version.getDeprecatedIntegerVersion();
                 }
                 else
                 {
@@ -203,15 +208,15 @@ void Global::PreInitializeResources(ResourceControl *resources)
                         {
                             if (strcmp(child2->name(), "growBreachMultiplier") == 0)
                             {
-                                ErosionEffect::growBreachMultiplier = boost::lexical_cast<float>(child2->value());
+                                ErosionEffect::growBreachMultiplier = XMLValue::Value<float>(child2);
                             }
                             else if (strcmp(child2->name(), "newBreachDamage") == 0)
                             {
-                                ErosionEffect::newBreachDamage = boost::lexical_cast<float>(child2->value());
+                                ErosionEffect::newBreachDamage = XMLValue::Value<float>(child2);
                             }
                             else if (strcmp(child2->name(), "newBreachRequirement") == 0)
                             {
-                                ErosionEffect::newBreachRequirement = boost::lexical_cast<float>(child2->value());
+                                ErosionEffect::newBreachRequirement = XMLValue::Value<float>(child2);
                             }
                             else if (strcmp(child2->name(), "canDilate") == 0)
                             {
@@ -323,7 +328,11 @@ void Global::InitializeResources(ResourceControl *resources)
         // First Pass
         for (auto node = parentNode->first_node(); node; node = node->next_sibling())
         {
-            if (strcmp(node->name(), "hullNumbers") == 0)
+            std::string nodeName = node->name();
+
+            switch (XMLTag::Hash(nodeName))
+            {
+            HS_XML_TAG(nodeName, "hullNumbers")
             {
                 if (node->first_attribute("enabled"))
                 {
@@ -337,53 +346,53 @@ void Global::InitializeResources(ResourceControl *resources)
                     }
                 }
             }
-
-            if (strcmp(node->name(), "hullBars") == 0)
+            break;
+            HS_XML_TAG(nodeName, "hullBars")
             {
                 HullBars::GetInstance()->ParseHullBarsNode(node);
             }
-
-            if (strcmp(node->name(), "hackingDroneFix") == 0)
+            break;
+            HS_XML_TAG(nodeName, "hackingDroneFix")
             {
                 auto enabled = node->first_attribute("enabled")->value();
                 g_hackingDroneFix = EventsParser::ParseBoolean(enabled);
             }
-
-            if (strcmp(node->name(), "repairDroneRecoveryFix") == 0)
+            break;
+            HS_XML_TAG(nodeName, "repairDroneRecoveryFix")
             {
                 auto enabled = node->first_attribute("enabled")->value();
                 g_repairDroneRecoveryFix = EventsParser::ParseBoolean(enabled);
             }
-
-            if (strcmp(node->name(), "controllableIonDroneFix") == 0)
+            break;
+            HS_XML_TAG(nodeName, "controllableIonDroneFix")
             {
                 auto enabled = node->first_attribute("enabled")->value();
                 g_controllableIonDroneFix = EventsParser::ParseBoolean(enabled);
                 if (g_controllableIonDroneFix && node->first_attribute("ionDelay"))
                 {
-                    float delay = boost::lexical_cast<float>(node->first_attribute("ionDelay")->value());
+                    float delay = XMLValue::Attribute<float>(node, "ionDelay");
                     g_controllableIonDroneFix_Delay = delay;
                     g_controllableIonDroneFix_DelayInitial = delay;
                 }
                 if (g_controllableIonDroneFix && node->first_attribute("ionDelayInitial"))
                 {
-                    g_controllableIonDroneFix_DelayInitial = boost::lexical_cast<float>(node->first_attribute("ionDelayInitial")->value());
+                    g_controllableIonDroneFix_DelayInitial = XMLValue::Attribute<float>(node, "ionDelayInitial");
                 }
             }
-
-            if (strcmp(node->name(), "enemyPreigniterFix") == 0) // enables enemies to have their weapons enabled and preignited
+            break;
+            HS_XML_TAG(nodeName, "enemyPreigniterFix") // enables enemies to have their weapons enabled and preignited
             {
                 auto enabled = node->first_attribute("enabled")->value();
                 g_enemyPreigniterFix = EventsParser::ParseBoolean(enabled);
             }
-
-            if (strcmp(node->name(), "crystalShardFix") == 0) // fixes crystal shards being targeted by friendly defense drones; default true
+            break;
+            HS_XML_TAG(nodeName, "crystalShardFix") // fixes crystal shards being targeted by friendly defense drones; default true
             {
                 auto enabled = node->first_attribute("enabled")->value();
                 g_crystalShardFix = EventsParser::ParseBoolean(enabled);
             }
-
-            if (strcmp(node->name(), "defenseDroneFix") == 0) // fixes defense drone blind spot by making the visible area resize with the ship
+            break;
+            HS_XML_TAG(nodeName, "defenseDroneFix") // fixes defense drone blind spot by making the visible area resize with the ship
             {
                 auto enabled = node->first_attribute("enabled")->value();
                 g_defenseDroneFix = EventsParser::ParseBoolean(enabled);
@@ -395,62 +404,62 @@ void Global::InitializeResources(ResourceControl *resources)
                         {
                             if (child->value())
                             {
-                                g_defenseDroneFix_BoxRange[0] = boost::lexical_cast<float>(child->value());
+                                g_defenseDroneFix_BoxRange[0] = XMLValue::Value<float>(child);
                                 g_defenseDroneFix_BoxRange[1] = g_defenseDroneFix_BoxRange[0];
                             }
                             if (child->first_attribute("player"))
                             {
-                                g_defenseDroneFix_BoxRange[0] = boost::lexical_cast<float>(child->first_attribute("player")->value());
+                                g_defenseDroneFix_BoxRange[0] = XMLValue::Attribute<float>(child, "player");
                             }
                             if (child->first_attribute("enemy"))
                             {
-                                g_defenseDroneFix_BoxRange[1] = boost::lexical_cast<float>(child->first_attribute("enemy")->value());
+                                g_defenseDroneFix_BoxRange[1] = XMLValue::Attribute<float>(child, "enemy");
                             }
                         }
                         if (strcmp(child->name(), "ellipseRange") == 0)
                         {
                             if (child->value())
                             {
-                                g_defenseDroneFix_EllipseRange[0] = boost::lexical_cast<float>(child->value());
+                                g_defenseDroneFix_EllipseRange[0] = XMLValue::Value<float>(child);
                                 g_defenseDroneFix_EllipseRange[1] = g_defenseDroneFix_EllipseRange[0];
                             }
                             if (child->first_attribute("player"))
                             {
-                                g_defenseDroneFix_EllipseRange[0] = boost::lexical_cast<float>(child->first_attribute("player")->value());
+                                g_defenseDroneFix_EllipseRange[0] = XMLValue::Attribute<float>(child, "player");
                             }
                             if (child->first_attribute("enemy"))
                             {
-                                g_defenseDroneFix_EllipseRange[1] = boost::lexical_cast<float>(child->first_attribute("enemy")->value());
+                                g_defenseDroneFix_EllipseRange[1] = XMLValue::Attribute<float>(child, "enemy");
                             }
                         }
                     }
                 }
             }
-
-            if (strcmp(node->name(), "artilleryGibMountFix") == 0) // fixes artillery disappearing during ship explosions
+            break;
+            HS_XML_TAG(nodeName, "artilleryGibMountFix") // fixes artillery disappearing during ship explosions
             {
                 auto enabled = node->first_attribute("enabled")->value();
                 g_artilleryGibMountFix = EventsParser::ParseBoolean(enabled);
             }
-
-            if (strcmp(node->name(), "warningLightPositionFix") == 0)
+            break;
+            HS_XML_TAG(nodeName, "warningLightPositionFix")
             {
                 auto enabled = node->first_attribute("enabled")->value();
                 g_warningLightPositionFix = EventsParser::ParseBoolean(enabled);
             }
-
-            if (strcmp(node->name(), "hideHullDuringExplosion") == 0)
+            break;
+            HS_XML_TAG(nodeName, "hideHullDuringExplosion")
             {
                 auto enabled = node->first_attribute("enabled")->value();
                 g_hideHullDuringExplosion = EventsParser::ParseBoolean(enabled);
             }
-
-            if (strcmp(node->name(), "resistsMindControlStat") == 0)
+            break;
+            HS_XML_TAG(nodeName, "resistsMindControlStat")
             {
                 auto enabled = node->first_attribute("enabled")->value();
                 g_resistsMindControlStat = EventsParser::ParseBoolean(enabled);
             }
-
+            break;
             /*
             if (strcmp(node->name(), "dronesCanTeleport") == 0)
             {
@@ -458,68 +467,70 @@ void Global::InitializeResources(ResourceControl *resources)
                 g_dronesCanTeleport = EventsParser::ParseBoolean(enabled);
             }
             */
-
-            if (strcmp(node->name(), "alternateCrewMovement") == 0)
+            HS_XML_TAG(nodeName, "alternateCrewMovement")
             {
                 auto enabled = node->first_attribute("enabled")->value();
                 customOptions->alternateCrewMovement.defaultValue = EventsParser::ParseBoolean(enabled);
                 customOptions->alternateCrewMovement.currentValue = EventsParser::ParseBoolean(enabled);
             }
-
-            if (strcmp(node->name(), "rightClickDoorOpening") == 0)
+            break;
+            HS_XML_TAG(nodeName, "rightClickDoorOpening")
             {
                 auto enabled = node->first_attribute("enabled")->value();
                 customOptions->rightClickDoorOpening.defaultValue = EventsParser::ParseBoolean(enabled);
                 customOptions->rightClickDoorOpening.currentValue = EventsParser::ParseBoolean(enabled);
             }
-
-            if (strcmp(node->name(), "redesignedWeaponTooltips") == 0)
+            break;
+            HS_XML_TAG(nodeName, "redesignedWeaponTooltips")
             {
                 auto enabled = node->first_attribute("enabled")->value();
                 customOptions->redesignedWeaponTooltips.defaultValue = EventsParser::ParseBoolean(enabled);
                 customOptions->redesignedWeaponTooltips.currentValue = EventsParser::ParseBoolean(enabled);
             }
-            if (strcmp(node->name(), "redesignedCrewTooltips") == 0)
+            break;
+            HS_XML_TAG(nodeName, "redesignedCrewTooltips")
             {
                 auto enabled = node->first_attribute("enabled")->value();
                 customOptions->redesignedCrewTooltips.defaultValue = EventsParser::ParseBoolean(enabled);
                 customOptions->redesignedCrewTooltips.currentValue = EventsParser::ParseBoolean(enabled);
             }
-            if (strcmp(node->name(), "redesignedDroneTooltips") == 0)
+            break;
+            HS_XML_TAG(nodeName, "redesignedDroneTooltips")
             {
                 auto enabled = node->first_attribute("enabled")->value();
                 customOptions->redesignedDroneTooltips.defaultValue = EventsParser::ParseBoolean(enabled);
                 customOptions->redesignedDroneTooltips.currentValue = EventsParser::ParseBoolean(enabled);
             }
-            if (strcmp(node->name(), "redesignedAugmentTooltips") == 0)
+            break;
+            HS_XML_TAG(nodeName, "redesignedAugmentTooltips")
             {
                 auto enabled = node->first_attribute("enabled")->value();
                 customOptions->redesignedAugmentTooltips.defaultValue = EventsParser::ParseBoolean(enabled);
                 customOptions->redesignedAugmentTooltips.currentValue = EventsParser::ParseBoolean(enabled);
             }
-
-            if (strcmp(node->name(), "eventTooltips") == 0)
+            break;
+            HS_XML_TAG(nodeName, "eventTooltips")
             {
                 auto enabled = node->first_attribute("enabled")->value();
                 customOptions->eventTooltips.defaultValue = EventsParser::ParseBoolean(enabled);
                 customOptions->eventTooltips.currentValue = EventsParser::ParseBoolean(enabled);
             }
-
-            if (strcmp(node->name(), "showNumericalWeaponCooldown") == 0)
+            break;
+            HS_XML_TAG(nodeName, "showNumericalWeaponCooldown")
             {
                 auto enabled = node->first_attribute("enabled")->value();
                 customOptions->showWeaponCooldown.defaultValue = EventsParser::ParseBoolean(enabled);
                 customOptions->showWeaponCooldown.currentValue = EventsParser::ParseBoolean(enabled);
             }
-
-            if (strcmp(node->name(), "showReactor") == 0)
+            break;
+            HS_XML_TAG(nodeName, "showReactor")
             {
                 auto enabled = node->first_attribute("enabled")->value();
                 customOptions->showReactor.defaultValue = EventsParser::ParseBoolean(enabled);
                 customOptions->showReactor.currentValue = EventsParser::ParseBoolean(enabled);
             }
-
-            if (strcmp(node->name(), "extraShipInfo") == 0)
+            break;
+            HS_XML_TAG(nodeName, "extraShipInfo")
             {
                 auto showMissileCount = node->first_attribute("missileCount")->value();
                 customOptions->showMissileCount.defaultValue = EventsParser::ParseBoolean(showMissileCount);
@@ -533,50 +544,50 @@ void Global::InitializeResources(ResourceControl *resources)
                 customOptions->showCrewLimit.defaultValue = EventsParser::ParseBoolean(showCrewLimit);
                 customOptions->showCrewLimit.currentValue = EventsParser::ParseBoolean(showCrewLimit);
             }
-
-            if (strcmp(node->name(), "showAllConnections") == 0)
+            break;
+            HS_XML_TAG(nodeName, "showAllConnections")
             {
                 auto enabled = node->first_attribute("enabled")->value();
                 customOptions->showAllConnections.defaultValue = EventsParser::ParseBoolean(enabled);
                 customOptions->showAllConnections.currentValue = EventsParser::ParseBoolean(enabled);
             }
-
-            if (strcmp(node->name(), "showScrapCollectorScrap") == 0)
+            break;
+            HS_XML_TAG(nodeName, "showScrapCollectorScrap")
             {
                 auto enabled = node->first_attribute("enabled")->value();
                 customOptions->showScrapCollectorScrap.defaultValue = EventsParser::ParseBoolean(enabled);
                 customOptions->showScrapCollectorScrap.currentValue = EventsParser::ParseBoolean(enabled);
             }
-            
-            if (strcmp(node->name(), "preIgniteChargers") == 0)
+            break;
+            HS_XML_TAG(nodeName, "preIgniteChargers")
             {
                 auto enabled = node->first_attribute("enabled")->value();
                 customOptions->preIgniteChargers.defaultValue = EventsParser::ParseBoolean(enabled);
                 customOptions->preIgniteChargers.currentValue = EventsParser::ParseBoolean(enabled);
             }
-            
-            if (strcmp(node->name(), "altLockedMiniships") == 0)
+            break;
+            HS_XML_TAG(nodeName, "altLockedMiniships")
             {
                 auto enabled = node->first_attribute("enabled")->value();
                 customOptions->altLockedMiniships.defaultValue = EventsParser::ParseBoolean(enabled);
                 customOptions->altLockedMiniships.currentValue = EventsParser::ParseBoolean(enabled);
             }
-
-            if (strcmp(node->name(), "altCreditSystem") == 0)
+            break;
+            HS_XML_TAG(nodeName, "altCreditSystem")
             {
                 auto enabled = node->first_attribute("enabled")->value();
                 customOptions->altCreditSystem.defaultValue = EventsParser::ParseBoolean(enabled);
                 customOptions->altCreditSystem.currentValue = EventsParser::ParseBoolean(enabled);
             }
-
-            if (strcmp(node->name(), "allowRenameInputSpecialCharacters") == 0)
+            break;
+            HS_XML_TAG(nodeName, "allowRenameInputSpecialCharacters")
             {
                 auto enabled = node->first_attribute("enabled")->value();
                 customOptions->allowRenameInputSpecialCharacters.defaultValue = EventsParser::ParseBoolean(enabled);
                 customOptions->allowRenameInputSpecialCharacters.currentValue = EventsParser::ParseBoolean(enabled);
             }
-
-            if (strcmp(node->name(), "alternateOxygenRendering") == 0)
+            break;
+            HS_XML_TAG(nodeName, "alternateOxygenRendering")
             {
                 auto enabled = node->first_attribute("enabled")->value();
                 customOptions->alternateOxygenRendering.defaultValue = EventsParser::ParseBoolean(enabled);
@@ -596,8 +607,8 @@ void Global::InitializeResources(ResourceControl *resources)
                     }
                 }
             }
-
-            if (strcmp(node->name(), "advancedCrewTooltips") == 0)
+            break;
+            HS_XML_TAG(nodeName, "advancedCrewTooltips")
             {
                 auto enabled = node->first_attribute("enabled")->value();
                 customOptions->advancedCrewTooltips.defaultValue = EventsParser::ParseBoolean(enabled);
@@ -616,19 +627,19 @@ void Global::InitializeResources(ResourceControl *resources)
                     }
                     if(node->first_attribute("rounding"))
                     {
-                        customOptions->advancedCrewTooltipRounding.defaultValue = boost::lexical_cast<int>(node->first_attribute("rounding")->value());
-                        customOptions->advancedCrewTooltipRounding.currentValue = boost::lexical_cast<int>(node->first_attribute("rounding")->value());
+                        customOptions->advancedCrewTooltipRounding.defaultValue = XMLValue::Attribute<int>(node, "rounding");
+                        customOptions->advancedCrewTooltipRounding.currentValue = XMLValue::Attribute<int>(node, "rounding");
                     }
                 }
             }
-
-            if (strcmp(node->name(), "roamingShips") == 0)
+            break;
+            HS_XML_TAG(nodeName, "roamingShips")
             {
                 auto roamingManager = RoamingShipsManager::GetInstance();
                 roamingManager->ParseShipsNode(node);
             }
-
-            if (strcmp(node->name(), "dismissSound") == 0)
+            break;
+            HS_XML_TAG(nodeName, "dismissSound")
             {
                 auto enabled = node->first_attribute("enabled")->value();
                 if (EventsParser::ParseBoolean(enabled))
@@ -645,8 +656,8 @@ void Global::InitializeResources(ResourceControl *resources)
                     customOptions->dismissSound.currentValue = "";
                 }
             }
-
-            if (strcmp(node->name(), "console") == 0)
+            break;
+            HS_XML_TAG(nodeName, "console")
             {
                 auto enabled = node->first_attribute("enabled")->value();
                 CommandConsole::GetInstance()->enabled = EventsParser::ParseBoolean(enabled);
@@ -657,14 +668,14 @@ void Global::InitializeResources(ResourceControl *resources)
                     CommandConsole::GetInstance()->invertCaps = EventsParser::ParseBoolean(invertCaps);
                 }
             }
-
-            if (strcmp(node->name(), "infinite") == 0)
+            break;
+            HS_XML_TAG(nodeName, "infinite")
             {
                 auto enabled = node->first_attribute("enabled")->value();
                 g_infiniteMode = EventsParser::ParseBoolean(enabled);
             }
-
-            if (strcmp(node->name(), "transformColorMode") == 0)
+            break;
+            HS_XML_TAG(nodeName, "transformColorMode")
             {
                 if (strcmp(node->name(), "KEEP_COLORS") == 0)
                 {
@@ -675,8 +686,8 @@ void Global::InitializeResources(ResourceControl *resources)
                     g_transformColorMode = TransformColorMode::KEEP_INDICES;
                 }
             }
-
-            if (strcmp(node->name(), "showShipAchievements") == 0)
+            break;
+            HS_XML_TAG(nodeName, "showShipAchievements")
             {
                 auto customShipManager = CustomShipSelect::GetInstance();
                 if (node->first_attribute("enabled"))
@@ -696,88 +707,94 @@ void Global::InitializeResources(ResourceControl *resources)
                     customShipManager->shipAchievementsTitle = node->first_attribute("id")->value();
                 }
             }
-
-            if (strcmp(node->name(), "victories") == 0)
+            break;
+            HS_XML_TAG(nodeName, "victories")
             {
                 auto customUnlocks = CustomShipUnlocks::instance;
                 customUnlocks->ParseVictoryAchievements(node);
             }
-
-            if (strcmp(node->name(), "achievements") == 0)
+            break;
+            HS_XML_TAG(nodeName, "achievements")
             {
                 auto customAchievements = CustomAchievementTracker::instance;
                 customAchievements->ParseAchievements(node);
             }
-
-            if (strcmp(node->name(), "ships") == 0)
+            break;
+            HS_XML_TAG(nodeName, "ships")
             {
                 auto customShipManager = CustomShipSelect::GetInstance();
                 customShipManager->ParseShipsNode(node);
             }
-
-            if (strcmp(node->name(), "shipGenerators") == 0)
+            break;
+            HS_XML_TAG(nodeName, "shipGenerators")
             {
                 CustomShipGenerator::Init();
                 CustomShipGenerator::ParseGeneratorNode(node);
             }
-
-            if (strcmp(node->name(), "crew") == 0)
+            break;
+            HS_XML_TAG(nodeName, "crew")
             {
                 auto customCrewManager = CustomCrewManager::GetInstance();
                 customCrewManager->ParseCrewNode(node);
             }
-
-            if (strcmp(node->name(), "rewards") == 0)
+            break;
+            HS_XML_TAG(nodeName, "rewards")
             {
                 auto customRewardsManager = CustomRewardsManager::GetInstance();
                 customRewardsManager->ParseRewardsNode(node);
             }
-
-            if (strcmp(node->name(), "sectorMap") == 0)
+            break;
+            HS_XML_TAG(nodeName, "sectorMap")
             {
                 auto customSectorParser = CustomSectorManager::GetInstance();
                 customSectorParser->ParseCustomSectorMapNode(node);
             }
-
-            if (strcmp(node->name(), "events") == 0)
+            break;
+            HS_XML_TAG(nodeName, "events")
             {
                 auto customEventParser = CustomEventsParser::GetInstance();
                 customEventParser->ParseCustomEventNode(node);
             }
-
-            if (strcmp(node->name(), "augments") == 0)
+            break;
+            HS_XML_TAG(nodeName, "augments")
             {
                 auto customAugmentManager = CustomAugmentManager::GetInstance();
                 customAugmentManager->ParseCustomAugmentNode(node);
             }
-
-            if (strcmp(node->name(), "titleScreen") == 0)
+            break;
+            HS_XML_TAG(nodeName, "titleScreen")
             {
                 CustomMainMenu::GetInstance()->ParseTitleScreenNode(node);
             }
-            if (strcmp(node->name(), "forceDlc") == 0)
+            break;
+            HS_XML_TAG(nodeName, "forceDlc")
             {
                 Global::forceDlc = EventsParser::ParseBoolean(node->first_attribute("enabled")->value());
             }
-            if (strcmp(node->name(), "boss") == 0)
+            break;
+            HS_XML_TAG(nodeName, "boss")
             {
                 CustomBoss::instance->ParseBossNode(node);
             }
-            if (strcmp(node->name(), "store") == 0)
+            break;
+            HS_XML_TAG(nodeName, "store")
             {
                 CustomStore::instance->ParseStoreNode(node);
             }
-            if (strcmp(node->name(), "purchaseLimitNumber") == 0)
+            break;
+            HS_XML_TAG(nodeName, "purchaseLimitNumber")
             {
-                PurchaseLimitIndicatorInfo::fontSize = boost::lexical_cast<int>(node->first_attribute("fontSize")->value());
-                PurchaseLimitIndicatorInfo::x = boost::lexical_cast<int>(node->first_attribute("x")->value());
-                PurchaseLimitIndicatorInfo::y = boost::lexical_cast<int>(node->first_attribute("y")->value());
+                PurchaseLimitIndicatorInfo::fontSize = XMLValue::Attribute<int>(node, "fontSize");
+                PurchaseLimitIndicatorInfo::x = XMLValue::Attribute<int>(node, "x");
+                PurchaseLimitIndicatorInfo::y = XMLValue::Attribute<int>(node, "y");
             }
-            if (strcmp(node->name(), "drones") == 0)
+            break;
+            HS_XML_TAG(nodeName, "drones")
             {
                 CustomDroneManager::GetInstance()->ParseDroneNode(node);
             }
-            if (strcmp(node->name(), "seeds") == 0)
+            break;
+            HS_XML_TAG(nodeName, "seeds")
             {
                 if (node->first_attribute("enabled"))
                 {
@@ -796,7 +813,8 @@ void Global::InitializeResources(ResourceControl *resources)
                     SeedInputBox::seedsAllowMetaVars = EventsParser::ParseBoolean(node->first_attribute("allowMetaVars")->value());
                 }
             }
-            if (strcmp(node->name(), "renameShipInRun") == 0)
+            break;
+            HS_XML_TAG(nodeName, "renameShipInRun")
             {
                 if (node->first_attribute("enabled"))
                 {
@@ -807,11 +825,13 @@ void Global::InitializeResources(ResourceControl *resources)
                     CustomUpgrades::GetInstance()->allowButton = EventsParser::ParseBoolean(node->first_attribute("allowButton")->value());
                 }
             }
-            if (strcmp(node->name(), "customSystems") == 0)
+            break;
+            HS_XML_TAG(nodeName, "customSystems")
             {
                 ParseSystemsNode(node);
             }
-            if (strcmp(node->name(), "scripts") == 0)
+            break;
+            HS_XML_TAG(nodeName, "scripts")
             {
                 for (auto child = node->first_node(); child; child = child->next_sibling())
                 {
@@ -821,8 +841,9 @@ void Global::InitializeResources(ResourceControl *resources)
                     }
                 }
             }
+            break;
             #ifdef USE_DISCORD
-            if (strcmp(node->name(), "discord") == 0)
+            HS_XML_TAG(nodeName, "discord")
             {
                 auto enabled = EventsParser::ParseBoolean(node->first_attribute("enabled")->value());
 
@@ -851,21 +872,36 @@ void Global::InitializeResources(ResourceControl *resources)
                     DiscordHandler::GetInstance()->SetLargeImageText(details);
                 }
             }
+            break;
+            #else
+            HS_XML_TAG(nodeName, "discord") break;
             #endif // USE_DISCORD
-            if (strcmp(node->name(), "saveFile") == 0)
+            HS_XML_TAG(nodeName, "saveFile")
             {
                 SaveFileHandler::instance->ParseSaveFileNode(node);
             }
-            if (strcmp(node->name(), "systemNoPurchaseThreshold") == 0)
+            break;
+            HS_XML_TAG(nodeName, "systemNoPurchaseThreshold")
             {
                 auto enabled = node->first_attribute("enabled")->value();
                 SystemNoPurchaseThreshold::enabled = EventsParser::ParseBoolean(enabled);
                 if (SystemNoPurchaseThreshold::enabled)
                 {
-                    SystemNoPurchaseThreshold::threshold = boost::lexical_cast<int>(node->first_attribute("threshold")->value());
+                    SystemNoPurchaseThreshold::threshold = XMLValue::Attribute<int>(node, "threshold");
                     SystemNoPurchaseThreshold::replace = node->first_attribute("replace")->value();
                 }
             }
+            break;
+            // parsed by PreInitializeResources
+            HS_XML_TAG(nodeName, "version") break;
+            HS_XML_TAG(nodeName, "defaults") break;
+            HS_XML_TAG(nodeName, "colors") break;
+            HS_XML_TAG(nodeName, "languages") break;
+            HS_XML_TAG(nodeName, "customCredits") break;
+            HS_XML_TAG(nodeName, "customChoiceColors") break;
+            default:
+                XMLTag::Unknown("FTL", nodeName);
+            }
         }
 
         // Post-processing (might not be needed anymore)
@@ -4,3 +4,50 @@
 
 GL_Color& ParseColorNode(GL_Color& colorRef, rapidxml::xml_node<char>* node, bool divide=true);
 void InitializeResources(ResourceControl *resources);
+
+// Image resolved through ResourceControl::GetImageId the first time it is used,
+// so render code does not build and hash the path every frame
+struct ImageHandle
+{
+    ImageHandle(const std::string& _path) : path{_path}
+    {
+    }
+
+    GL_Texture *Get()
+    {
+        if (!resolved)
+        {
+            texture = G_->GetResources()->GetImageId(path);
+            resolved = true;
+        }
+        return texture;
+    }
+
+    std::string path;
+    GL_Texture *texture = nullptr;
+    bool resolved = false;
+};
+
+// Images named prefix + number + suffix, each resolved on first use
+struct NumberedImageHandle
+{
+    NumberedImageHandle(const std::string& _prefix, const std::string& _suffix) : prefix{_prefix}, suffix{_suffix}
+    {
+    }
+
+    GL_Texture *Get(int n)
+    {
+        if (n >= (int)handles.size())
+        {
+            for (int i = handles.size(); i <= n; ++i)
+            {
+                handles.emplace_back(prefix + std::to_string(i) + suffix);
+            }
+        }
+        return handles[n].Get();
+    }
+
+    std::string prefix;
+    std::string suffix;
+    std::vector<ImageHandle> handles;
+};
@@ -1,5 +1,5 @@
 #include "SaveFile.h"
-#include <boost/lexical_cast.hpp>
+#include "XMLValue.h"
 #include <boost/algorithm/string/predicate.hpp>
 #include <boost/algorithm/string/replace.hpp>
 
@@ -27,7 +27,7 @@ void SaveFileHandler::ParseSaveFileNode(rapidxml::xml_node<char>* node)
         }
         if (name == "inheritMode")
         {
-            inheritMode = (SaveFileHandler::InheritMode)boost::lexical_cast<int>(value);
+            inheritMode = (SaveFileHandler::InheritMode)XMLValue::Value<int>(child);
         }
         if (name == "welcomeDialog")
         {
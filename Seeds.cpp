@@ -2,6 +2,7 @@
 #include "FTLGame.h"
 #include "MainMenu.h"
 #include "Seeds.h"
+#include "Profiler.h"
 #include <boost/lexical_cast.hpp>
 #include <boost/algorithm/string.hpp>
 #include <iostream>
@@ -224,8 +225,11 @@ HOOK_METHOD(StarMap, SaveGame, (int file) -> void)
     LOG_HOOK("HOOK_METHOD -> StarMap::SaveGame -> Begin (Seeds.cpp)\n")
     FileHelper::writeInt(file, Global::currentSeed);
     FileHelper::writeInt(file, Global::isCustomSeed);
-    worldRng.Export(file);
-    secretRng.Export(file);
+    {
+        HS_PROFILE_SCOPE("SeededRng::Export");
+        worldRng.Export(file);
+        secretRng.Export(file);
+    }
     super(file);
 }
 
@@ -276,8 +280,11 @@ HOOK_METHOD(StarMap, LoadGame, (int fh) -> Location*)
 
     Global::currentSeed = FileHelper::readInteger(fh);
     Global::isCustomSeed = FileHelper::readInteger(fh);
-    worldRng.Import(fh);
-    secretRng.Import(fh);
+    {
+        HS_PROFILE_SCOPE("SeededRng::Import");
+        worldRng.Import(fh);
+        secretRng.Import(fh);
+    }
 
 	Location *ret = super(fh);
 
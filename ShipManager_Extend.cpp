@@ -27,7 +27,7 @@ HOOK_METHOD_PRIORITY(ShipManager, constructor, 900, (int iShipId) -> void)
     HS_MAKE_TABLE(this)
 
     auto context = G_->getLuaContext();
-    SWIG_NewPointerObj(context->GetLua(), this, context->getLibScript()->types.pShipManager, 0);
+    LuaLibScript::push_cached_pointer(context->GetLua(), this, context->getLibScript()->types.pShipManager);
     context->getLibScript()->call_on_internal_event_callbacks(InternalEvents::CONSTRUCT_SHIP_MANAGER, 1);
     lua_pop(context->GetLua(), 1);
 }
@@ -5,7 +5,7 @@
 #include "SaveFile.h"
 #include "Resources.h"
 #include "Seeds.h"
-#include <boost/lexical_cast.hpp>
+#include "XMLValue.h"
 #include <boost/algorithm/string.hpp>
 
 CustomShipUnlocks* CustomShipUnlocks::instance = new CustomShipUnlocks();
@@ -50,7 +50,7 @@ void CustomShipUnlocks::ParseUnlockNode(rapidxml::xml_node<char> *node, const st
 
         if (name == "type")
         {
-            shipUnlock.type = (ShipUnlock::UnlockType) boost::lexical_cast<int>(value);
+            shipUnlock.type = (ShipUnlock::UnlockType) XMLValue::Value<int>(child);
         }
         if (name == "shipReq")
         {
@@ -58,7 +58,7 @@ void CustomShipUnlocks::ParseUnlockNode(rapidxml::xml_node<char> *node, const st
         }
         if (name == "value")
         {
-            shipUnlock.value = boost::lexical_cast<int>(value);
+            shipUnlock.value = XMLValue::Value<int>(child);
         }
         if (name == "silent")
         {
@@ -230,6 +230,8 @@ void CustomShipUnlocks::LoadVersionOne(int file)
     {
         customUnlockedShips.push_back(FileHelper::readString(file));
     }
+
+    InvalidateShipUnlockStatus();
 }
 
 void CustomShipUnlocks::LoadVersionTwo(int file)
@@ -243,6 +245,8 @@ void CustomShipUnlocks::LoadVersionTwo(int file)
         customUnlockedShips.push_back(FileHelper::readString(file));
     }
 
+    InvalidateShipUnlockStatus();
+
     // customUnlockQuestShips
 
     customShipsLen = FileHelper::readInteger(file);
@@ -335,6 +339,37 @@ void CustomShipUnlocks::Save(int file)
     }
 }
 
+int CustomShipUnlocks::GetCachedShipUnlocked(int shipId, int variant)
+{
+    if (shipId < 0 || shipId >= (int)shipUnlockStatus.size() || variant < 0 || variant > 2) return -1;
+
+    return shipUnlockStatus[shipId][variant];
+}
+
+void CustomShipUnlocks::SetCachedShipUnlocked(int shipId, int variant, bool unlocked)
+{
+    if (shipId < 0 || variant < 0 || variant > 2) return;
+
+    if (shipId >= (int)shipUnlockStatus.size())
+    {
+        std::array<int8_t, 3> unknown = {-1, -1, -1};
+        shipUnlockStatus.resize(shipId + 1, unknown);
+    }
+
+    shipUnlockStatus[shipId][variant] = unlocked;
+}
+
+bool CustomShipUnlocks::GetShipIdUnlocked(int shipId, int variant)
+{
+    int cached = GetCachedShipUnlocked(shipId, variant);
+    if (cached != -1) return cached;
+
+    bool ret = GetCustomShipUnlocked(CustomShipSelect::GetInstance()->GetShipBlueprint(shipId), variant);
+    SetCachedShipUnlocked(shipId, variant, ret);
+
+    return ret;
+}
+
 void CustomShipUnlocks::UnlockShip(const std::string& ship, bool silent, bool checkMultiUnlocks, bool isEvent)
 {
     // unlock the ship
@@ -351,6 +386,7 @@ void CustomShipUnlocks::UnlockShip(const std::string& ship, bool silent, bool ch
             }
 
             customUnlockedShips.push_back(ship);
+            InvalidateShipUnlockStatus();
 
             if (checkMultiUnlocks)
             {
@@ -529,6 +565,7 @@ void CustomShipUnlocks::LockAchievement(CAchievement *ach)
 void CustomShipUnlocks::WipeProfile()
 {
     customUnlockedShips.clear();
+    InvalidateShipUnlockStatus();
     customUnlockQuestShips.clear();
     shipVictories.clear();
     customShipVictories.clear();
@@ -569,6 +606,7 @@ bool CustomShipUnlocks::CheckVanillaUnlocks(const ShipUnlock& unlock, const std:
 
     G_->GetScoreKeeper()->UnlockShip(shipId, variant, true, false);
     customUnlockedShips.push_back(unlock.unlocksShip);
+    InvalidateShipUnlockStatus();
 
     CheckMultiUnlocks();
 
@@ -748,53 +786,29 @@ HOOK_METHOD(AchievementTracker, LoadAchievementDescriptions, () -> void)
 HOOK_METHOD(ScoreKeeper, GetShipUnlocked, (int shipId, int shipVariant) -> bool)
 {
     LOG_HOOK("HOOK_METHOD -> ScoreKeeper::GetShipUnlocked -> Begin (ShipUnlocks.cpp)\n")
-    CustomShipSelect* custom = CustomShipSelect::GetInstance();
-
-    bool isCustomShip = shipId >= 100;
-
-    std::string shipBlueprint;
-
-    if (isCustomShip)
+    if (shipId >= 100)
     {
-        shipBlueprint = custom->GetShipBlueprint(shipId);
-    }
-    else
-    {
-        shipBlueprint = GetShipBlueprint(shipId);
+        return CustomShipUnlocks::instance->GetShipIdUnlocked(shipId, shipVariant);
     }
 
-    if (shipVariant == 1)
-    {
-        shipBlueprint.append("_2");
-    }
-    if (shipVariant == 2)
-    {
-        shipBlueprint.append("_3");
-    }
+    int cached = CustomShipUnlocks::instance->GetCachedShipUnlocked(shipId, shipVariant);
+    if (cached != -1) return cached;
+
+    bool ret = super(shipId, shipVariant);
 
-    if (isCustomShip)
+    if (!ret)
     {
+        std::string shipBlueprint = CustomShipSelect::GetVariantName(GetShipBlueprint(shipId), shipVariant);
+
         if (CustomShipUnlocks::instance->CustomShipHasUnlock(shipBlueprint))
         {
-            return CustomShipUnlocks::instance->GetCustomShipUnlocked(shipBlueprint);
-        }
-        else
-        {
-            return true;
+            ret = CustomShipUnlocks::instance->GetCustomShipUnlocked(shipBlueprint);
         }
     }
-    else
-    {
-        bool ret = super(shipId, shipVariant);
-
 
-        if (!ret && CustomShipUnlocks::instance->CustomShipHasUnlock(shipBlueprint))
-        {
-            return CustomShipUnlocks::instance->GetCustomShipUnlocked(shipBlueprint);
-        }
+    CustomShipUnlocks::instance->SetCachedShipUnlocked(shipId, shipVariant, ret);
 
-        return ret;
-    }
+    return ret;
 }
 
 HOOK_METHOD(ScoreKeeper, UnlockShip, (int shipId, int shipType, bool save, bool hidePopup) -> void)
@@ -830,6 +844,8 @@ HOOK_METHOD(ScoreKeeper, WipeProfile, (bool permanent) -> void)
     CustomShipUnlocks::instance->WipeProfile();
 
     super(permanent);
+
+    CustomShipUnlocks::instance->InvalidateShipUnlockStatus();
 }
 
 HOOK_METHOD(ScoreKeeper, OnInit, () -> void)
@@ -861,6 +877,8 @@ HOOK_METHOD(AchievementTracker, SetAchievement, (const std::string& ach, bool no
     }
 
     super(ach, noPopup, sendToServer);
+
+    CustomShipUnlocks::instance->InvalidateShipUnlockStatus();
 }
 
 HOOK_METHOD(AchievementTracker, UnlockShip, (int type, int variant) -> void)
@@ -869,6 +887,8 @@ HOOK_METHOD(AchievementTracker, UnlockShip, (int type, int variant) -> void)
     auto ach = shipUnlocks[type][variant];
     ach->unlocked = true;
     if (G_->GetSettings()->achPopups) recentlyUnlocked.push_back(ach);
+
+    CustomShipUnlocks::instance->InvalidateShipUnlockStatus();
 }
 
 HOOK_METHOD(StarMap, AdvanceWorldLevel, () -> void)
@@ -931,7 +951,9 @@ HOOK_METHOD(ScoreKeeper, UnlockShip, (int shipId, int shipType, bool save, bool
         hidePopup = true;
     }
 
-    return super(shipId, shipType, save, hidePopup);
+    super(shipId, shipType, save, hidePopup);
+
+    CustomShipUnlocks::instance->InvalidateShipUnlockStatus();
 }
 
 HOOK_METHOD(ScoreKeeper, LoadVersionFour, (int file, int version) -> void)
@@ -941,6 +963,8 @@ HOOK_METHOD(ScoreKeeper, LoadVersionFour, (int file, int version) -> void)
     super(file, version);
     loadingFile = false;
 
+    CustomShipUnlocks::instance->InvalidateShipUnlockStatus();
+
     CustomShipUnlocks::instance->CheckMultiUnlocks();
     CustomShipUnlocks::instance->CheckMultiVictoryUnlocks();
 }
@@ -91,6 +91,17 @@ public:
         return customShipUnlocks.find(name) != customShipUnlocks.end();
     }
 
+    // Unlock status by hangar ship id (vanilla ids and 100+ for custom ships).
+    // Results are kept in a dense table that is cleared whenever unlocks or the profile change.
+    bool GetShipIdUnlocked(int shipId, int variant);
+    int GetCachedShipUnlocked(int shipId, int variant);
+    void SetCachedShipUnlocked(int shipId, int variant, bool unlocked);
+
+    void InvalidateShipUnlockStatus()
+    {
+        shipUnlockStatus.clear();
+    }
+
     void RemoveShipUnlock(const std::string& name)
     {
         auto it = std::find(customUnlockedShips.begin(), customUnlockedShips.end(), name);
@@ -98,6 +109,7 @@ public:
         if (it != customUnlockedShips.end())
         {
             customUnlockedShips.erase(it);
+            InvalidateShipUnlockStatus();
         }
 
         G_->GetScoreKeeper()->Save(false);
@@ -201,6 +213,8 @@ public:
     std::unordered_map<std::string, CustomVictoryAchievement> customVictories;
 
 private:
+    std::vector<std::array<int8_t, 3>> shipUnlockStatus; // -1 = not computed, 0 = locked, 1 = unlocked
+
     std::unordered_map<std::string, std::vector<ShipUnlock>> customShipUnlocks;
     std::unordered_map<std::string, CAchievement*> customShipUnlockAchievements;
 
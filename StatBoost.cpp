@@ -7,9 +7,12 @@
 #include "CustomCrew.h"
 #include "CustomAugments.h"
 #include "TemporalSystem.h"
+#include "Profiler.h"
+#include "XMLTag.h"
+#include "XMLValue.h"
 #include <algorithm>
-#include <boost/lexical_cast.hpp>
 #include <math.h>
+#include <stdexcept>
 //#include <chrono>
 //#include <iostream>
 
@@ -142,11 +145,15 @@ StatBoostDefinition* StatBoostManager::ParseStatBoostNode(rapidxml::xml_node<cha
             {
                 std::string name = child->name();
                 std::string val = child->value();
-                if (name == "statBoost")
+
+                switch (XMLTag::Hash(name))
+                {
+                HS_XML_TAG(name, "statBoost")
                 {
                     def->providedStatBoosts.push_back(ParseStatBoostNode(child, StatBoostDefinition::BoostSource::CREW, false));
                 }
-                if (name == "boostType")
+                break;
+                HS_XML_TAG(name, "boostType")
                 {
                     if (val == "MULT")
                     {
@@ -181,58 +188,69 @@ StatBoostDefinition* StatBoostManager::ParseStatBoostNode(rapidxml::xml_node<cha
                         def->boostType = StatBoostDefinition::BoostType::REPLACE_POWER;
                     }
                 }
-
-                if (name == "amount")
+                break;
+                HS_XML_TAG(name, "amount")
                 {
-                    def->amount = boost::lexical_cast<float>(val);
+                    def->amount = XMLValue::Value<float>(child);
                 }
-                if (name == "value")
+                break;
+                HS_XML_TAG(name, "value")
                 {
                     def->value = EventsParser::ParseBoolean(val);
                 }
-                if (name == "dangerRating")
+                break;
+                HS_XML_TAG(name, "dangerRating")
                 {
-                    def->dangerRating = boost::lexical_cast<float>(val);
+                    def->dangerRating = XMLValue::Value<float>(child);
                 }
-
-                if (name == "race" && def->stat == CrewStat::TRANSFORM_RACE)
+                break;
+                HS_XML_TAG(name, "race")
                 {
-                    def->stringValue = val;
+                    if (def->stat == CrewStat::TRANSFORM_RACE) def->stringValue = val;
                 }
-                if (name == "permanent" && def->stat == CrewStat::TRANSFORM_RACE)
+                break;
+                HS_XML_TAG(name, "permanent")
                 {
-                    def->value = EventsParser::ParseBoolean(val);
+                    if (def->stat == CrewStat::TRANSFORM_RACE) def->value = EventsParser::ParseBoolean(val);
                 }
-                if (name == "duration")
+                break;
+                HS_XML_TAG(name, "duration")
                 {
-                    def->duration = boost::lexical_cast<float>(val);
+                    def->duration = XMLValue::Value<float>(child);
                 }
-                if (name == "jumpClear")
+                break;
+                HS_XML_TAG(name, "jumpClear")
                 {
                     def->jumpClear = EventsParser::ParseBoolean(val);
                 }
-                if (name == "cloneClear")
+                break;
+                HS_XML_TAG(name, "cloneClear")
                 {
                     def->cloneClear = EventsParser::ParseBoolean(val);
                 }
-                if (name == "priority")
+                break;
+                HS_XML_TAG(name, "priority")
                 {
-                    def->priority = boost::lexical_cast<int>(val);
+                    def->priority = XMLValue::Value<int>(child);
                 }
-                if (name == "boostAnim")
+                break;
+                HS_XML_TAG(name, "boostAnim")
                 {
                     def->boostAnim = val;
                 }
-                if (name == "roomAnim")
+                break;
+                HS_XML_TAG(name, "roomAnim")
                 {
                     def->roomAnim = new RoomAnimDef();
                     def->roomAnim->ParseRoomAnimNode(child);
                 }
-                if (name == "affectsSelf")
+                break;
+                HS_XML_TAG(name, "affectsSelf")
                 {
                     def->affectsSelf = EventsParser::ParseBoolean(val);
                 }
-                if (name == "shipTarget")
+                break;
+                HS_XML_TAG(name, "shipTarget")
                 {
                     if (val == "PLAYER_SHIP")
                     {
@@ -275,7 +293,8 @@ StatBoostDefinition* StatBoostManager::ParseStatBoostNode(rapidxml::xml_node<cha
                         def->shipTarget = StatBoostDefinition::ShipTarget::TARGETS_ME;
                     }
                 }
-                if (name == "systemRoomTarget")
+                break;
+                HS_XML_TAG(name, "systemRoomTarget")
                 {
                     if (val == "ALL")
                     {
@@ -286,7 +305,8 @@ StatBoostDefinition* StatBoostManager::ParseStatBoostNode(rapidxml::xml_node<cha
                         def->systemRoomTarget = StatBoostDefinition::SystemRoomTarget::NONE;
                     }
                 }
-                if (name == "crewTarget")
+                break;
+                HS_XML_TAG(name, "crewTarget")
                 {
                     if (val == "ALLIES")
                     {
@@ -326,7 +346,8 @@ StatBoostDefinition* StatBoostManager::ParseStatBoostNode(rapidxml::xml_node<cha
                         def->crewTarget = StatBoostDefinition::CrewTarget::SELF;
                     }
                 }
-                if (name == "droneTarget")
+                break;
+                HS_XML_TAG(name, "droneTarget")
                 {
                     if (val == "DRONES")
                     {
@@ -341,11 +362,13 @@ StatBoostDefinition* StatBoostManager::ParseStatBoostNode(rapidxml::xml_node<cha
                         def->droneTarget = StatBoostDefinition::DroneTarget::ALL;
                     }
                 }
-                if (name == "functionalTarget")
+                break;
+                HS_XML_TAG(name, "functionalTarget")
                 {
                     def->functionalTarget = EventsParser::ParseBoolean(val);;
                 }
-                if (name == "whiteList")
+                break;
+                HS_XML_TAG(name, "whiteList")
                 {
                     if (child->first_attribute("load"))
                     {
@@ -365,7 +388,8 @@ StatBoostDefinition* StatBoostManager::ParseStatBoostNode(rapidxml::xml_node<cha
                     }
                     def->whiteList.shrink_to_fit();
                 }
-                if (name == "blackList")
+                break;
+                HS_XML_TAG(name, "blackList")
                 {
                     if (child->first_attribute("load"))
                     {
@@ -385,45 +409,52 @@ StatBoostDefinition* StatBoostManager::ParseStatBoostNode(rapidxml::xml_node<cha
                     }
                     def->blackList.shrink_to_fit();
                 }
-                if (name == "healthReq")
+                break;
+                HS_XML_TAG(name, "healthReq")
                 {
-                    if (child->first_attribute("min")) def->healthReq.first = boost::lexical_cast<float>(child->first_attribute("min")->value());
-                    if (child->first_attribute("max")) def->healthReq.second = boost::lexical_cast<float>(child->first_attribute("max")->value());
-                    if (child->first_attribute("above")) def->healthReq.first = std::nextafterf(boost::lexical_cast<float>(child->first_attribute("above")->value()), +HUGE_VAL);
-                    if (child->first_attribute("below")) def->healthReq.second = std::nextafterf(boost::lexical_cast<float>(child->first_attribute("below")->value()), -HUGE_VAL);
+                    if (child->first_attribute("min")) def->healthReq.first = XMLValue::Attribute<float>(child, "min");
+                    if (child->first_attribute("max")) def->healthReq.second = XMLValue::Attribute<float>(child, "max");
+                    if (child->first_attribute("above")) def->healthReq.first = std::nextafterf(XMLValue::Attribute<float>(child, "above"), +HUGE_VAL);
+                    if (child->first_attribute("below")) def->healthReq.second = std::nextafterf(XMLValue::Attribute<float>(child, "below"), -HUGE_VAL);
                 }
-                if (name == "healthFractionReq")
+                break;
+                HS_XML_TAG(name, "healthFractionReq")
                 {
-                    if (child->first_attribute("min")) def->healthFractionReq.first = boost::lexical_cast<float>(child->first_attribute("min")->value());
-                    if (child->first_attribute("max")) def->healthFractionReq.second = boost::lexical_cast<float>(child->first_attribute("max")->value());
-                    if (child->first_attribute("above")) def->healthFractionReq.first = std::nextafterf(boost::lexical_cast<float>(child->first_attribute("above")->value()), +HUGE_VAL);
-                    if (child->first_attribute("below")) def->healthFractionReq.second = std::nextafterf(boost::lexical_cast<float>(child->first_attribute("below")->value()), -HUGE_VAL);
+                    if (child->first_attribute("min")) def->healthFractionReq.first = XMLValue::Attribute<float>(child, "min");
+                    if (child->first_attribute("max")) def->healthFractionReq.second = XMLValue::Attribute<float>(child, "max");
+                    if (child->first_attribute("above")) def->healthFractionReq.first = std::nextafterf(XMLValue::Attribute<float>(child, "above"), +HUGE_VAL);
+                    if (child->first_attribute("below")) def->healthFractionReq.second = std::nextafterf(XMLValue::Attribute<float>(child, "below"), -HUGE_VAL);
                 }
-                if (name == "oxygenReq")
+                break;
+                HS_XML_TAG(name, "oxygenReq")
                 {
-                    if (child->first_attribute("min")) def->oxygenReq.first = boost::lexical_cast<float>(child->first_attribute("min")->value());
-                    if (child->first_attribute("max")) def->oxygenReq.second = boost::lexical_cast<float>(child->first_attribute("max")->value());
-                    if (child->first_attribute("above")) def->oxygenReq.first = std::nextafterf(boost::lexical_cast<float>(child->first_attribute("above")->value()), +HUGE_VAL);
-                    if (child->first_attribute("below")) def->oxygenReq.second = std::nextafterf(boost::lexical_cast<float>(child->first_attribute("below")->value()), -HUGE_VAL);
+                    if (child->first_attribute("min")) def->oxygenReq.first = XMLValue::Attribute<float>(child, "min");
+                    if (child->first_attribute("max")) def->oxygenReq.second = XMLValue::Attribute<float>(child, "max");
+                    if (child->first_attribute("above")) def->oxygenReq.first = std::nextafterf(XMLValue::Attribute<float>(child, "above"), +HUGE_VAL);
+                    if (child->first_attribute("below")) def->oxygenReq.second = std::nextafterf(XMLValue::Attribute<float>(child, "below"), -HUGE_VAL);
                 }
-                if (name == "fireCount")
+                break;
+                HS_XML_TAG(name, "fireCount")
                 {
-                    if (child->first_attribute("min")) def->fireCount.first = boost::lexical_cast<int>(child->first_attribute("min")->value());
-                    if (child->first_attribute("max")) def->fireCount.second = boost::lexical_cast<int>(child->first_attribute("max")->value());
+                    if (child->first_attribute("min")) def->fireCount.first = XMLValue::Attribute<int>(child, "min");
+                    if (child->first_attribute("max")) def->fireCount.second = XMLValue::Attribute<int>(child, "max");
                 }
-                if (name == "extraConditions")
+                break;
+                HS_XML_TAG(name, "extraConditions")
                 {
                     auto &extraConditions = (child->first_attribute("type") && strcmp(child->first_attribute("type")->value(), "or") == 0) ? def->extraOrConditions : def->extraConditions;
                     CustomCrewManager::GetInstance()->ParseExtraConditionsNode(child, extraConditions);
                 }
-                if (name == "systemList")
+                break;
+                HS_XML_TAG(name, "systemList")
                 {
                     for (auto crewChild = child->first_node(); crewChild; crewChild = crewChild->next_sibling())
                     {
                         def->systemList.push_back(crewChild->name());
                     }
                 }
-                if (name == "systemPowerDependency")
+                break;
+                HS_XML_TAG(name, "systemPowerDependency")
                 {
                     for (auto systemChild = child->first_node(); systemChild; systemChild = systemChild->next_sibling())
                     {
@@ -450,7 +481,8 @@ StatBoostDefinition* StatBoostManager::ParseStatBoostNode(rapidxml::xml_node<cha
                         }
                     }
                 }
-                if (name == "systemPowerScaling")
+                break;
+                HS_XML_TAG(name, "systemPowerScaling")
                 {
                     bool noSys = false;
                     bool hackedSys = false;
@@ -462,16 +494,16 @@ StatBoostDefinition* StatBoostManager::ParseStatBoostNode(rapidxml::xml_node<cha
                         if (systemChildName == "noSys")
                         {
                             noSys = true;
-                            def->powerScalingNoSys = boost::lexical_cast<float>(systemChild->value());
+                            def->powerScalingNoSys = XMLValue::Value<float>(systemChild);
                         }
                         else if (systemChildName == "hackedSys")
                         {
                             hackedSys = true;
-                            def->powerScalingHackedSys = boost::lexical_cast<float>(systemChild->value());
+                            def->powerScalingHackedSys = XMLValue::Value<float>(systemChild);
                         }
                         else
                         {
-                            def->powerScaling.push_back(boost::lexical_cast<float>(systemChild->value()));
+                            def->powerScaling.push_back(XMLValue::Value<float>(systemChild));
                         }
                     }
 
@@ -487,11 +519,12 @@ StatBoostDefinition* StatBoostManager::ParseStatBoostNode(rapidxml::xml_node<cha
                         }
                     }
                 }
-                if (name == "maxStacks")
+                break;
+                HS_XML_TAG(name, "maxStacks")
                 {
                     if (!val.empty())
                     {
-                        def->maxStacks = boost::lexical_cast<int>(val);
+                        def->maxStacks = XMLValue::Value<int>(child);
                     }
                     if (child->first_attribute("id"))
                     {
@@ -502,7 +535,8 @@ StatBoostDefinition* StatBoostManager::ParseStatBoostNode(rapidxml::xml_node<cha
                         def->stackId = GiveStackId();
                     }
                 }
-                if (name == "deathEffect")
+                break;
+                HS_XML_TAG(name, "deathEffect")
                 {
                     def->deathEffectChange = new ExplosionDefinition();
 
@@ -552,14 +586,15 @@ StatBoostDefinition* StatBoostManager::ParseStatBoostNode(rapidxml::xml_node<cha
 
                     CustomCrewManager::GetInstance()->ParseDeathEffect(child, def->deathEffectChange);
                 }
-                if (name == "powerEffect")
+                break;
+                HS_XML_TAG(name, "powerEffect")
                 {
                     ActivatedPowerDefinition *powerDef = CustomCrewManager::GetInstance()->ParseAbilityEffect(child);
                     def->powerChange = powerDef;
                 }
-
+                break;
                 // power whitelist and blacklist store the pointers to powerDef
-                if (name == "powerWhitelist")
+                HS_XML_TAG(name, "powerWhitelist")
                 {
                     for (auto child2 = child->first_node(); child2; child2 = child2->next_sibling())
                     {
@@ -575,7 +610,8 @@ StatBoostDefinition* StatBoostManager::ParseStatBoostNode(rapidxml::xml_node<cha
                         }
                     }
                 }
-                if (name == "powerBlacklist")
+                break;
+                HS_XML_TAG(name, "powerBlacklist")
                 {
                     for (auto child2 = child->first_node(); child2; child2 = child2->next_sibling())
                     {
@@ -591,9 +627,9 @@ StatBoostDefinition* StatBoostManager::ParseStatBoostNode(rapidxml::xml_node<cha
                         }
                     }
                 }
-
+                break;
                 // power group whitelist and blacklist gets the integer ID corresponding to each name and stores it
-                if (name == "powerGroupWhitelist")
+                HS_XML_TAG(name, "powerGroupWhitelist")
                 {
                     for (auto child2 = child->first_node(); child2; child2 = child2->next_sibling())
                     {
@@ -601,7 +637,8 @@ StatBoostDefinition* StatBoostManager::ParseStatBoostNode(rapidxml::xml_node<cha
                         def->powerGroupWhitelist.emplace(ActivatedPowerDefinition::GetReplaceGroup(groupName));
                     }
                 }
-                if (name == "powerGroupBlacklist")
+                break;
+                HS_XML_TAG(name, "powerGroupBlacklist")
                 {
                     for (auto child2 = child->first_node(); child2; child2 = child2->next_sibling())
                     {
@@ -609,6 +646,10 @@ StatBoostDefinition* StatBoostManager::ParseStatBoostNode(rapidxml::xml_node<cha
                         def->powerGroupBlacklist.emplace(ActivatedPowerDefinition::GetReplaceGroup(groupName));
                     }
                 }
+                break;
+                default:
+                    XMLTag::Unknown("statBoost", name);
+                }
             }
         }
         else
@@ -830,6 +871,8 @@ void StatBoostManager::AddRoomStatBoosts(ShipManager *ship)
 
 void StatBoostManager::OnLoop(WorldManager* world)
 {
+    HS_PROFILE_SCOPE("StatBoostManager::OnLoop");
+
     Clear();
 
     playerShip = world->playerShip->shipManager;
@@ -1822,12 +1865,16 @@ float CrewMember_Extend::CalculateStat(CrewStat stat, const CrewDefinition* def,
 //    using std::chrono::milliseconds;
 //    auto t1 = steady_clock::now();
 
-    if ((unsigned int)stat < numCachedStats && statCache[(unsigned int)stat].second == StatBoostManager::statCacheFrame)
+    float cachedStat;
+    if (GetCachedStat((unsigned int)stat, cachedStat))
     {
-        if (boolValue != nullptr) *boolValue = statCache[(unsigned int)stat].first;
-        return statCache[(unsigned int)stat].first;
+        if (boolValue != nullptr) *boolValue = cachedStat;
+        return cachedStat;
     }
 
+    // only cache misses are timed, a scope around the cached return would cost more than the lookup itself
+    HS_PROFILE_SCOPE("CrewMember_Extend::CalculateStat");
+
     std::vector<StatBoost> personalStatBoosts;
     std::unordered_map<int, std::vector<StatBoost*>> stackLimitedStatBoosts;
     auto& statBoosts = StatBoostManager::GetInstance()->statBoosts;
@@ -2723,18 +2770,13 @@ float CrewMember_Extend::CalculateStat(CrewStat stat, const CrewDefinition* def,
             }
         }
     }
-    if ((unsigned int)stat < numCachedStats)
+    if (isBool)
     {
-        if (isBool)
-        {
-            statCache[(unsigned int)stat].first = *boolValue;
-            statCache[(unsigned int)stat].second = StatBoostManager::statCacheFrame;
-        }
-        else if (!isEffect)
-        {
-            statCache[(unsigned int)stat].first = finalStat;
-            statCache[(unsigned int)stat].second = StatBoostManager::statCacheFrame;
-        }
+        SetCachedStat((unsigned int)stat, *boolValue);
+    }
+    else if (!isEffect)
+    {
+        SetCachedStat((unsigned int)stat, finalStat);
     }
 
 //    auto t2 = steady_clock::now();
@@ -2776,7 +2818,7 @@ HOOK_METHOD(MainMenu, Open, () -> void)
     super();
 }
 
-int CrewMember_Extend::CalculateDangerRating(float health, int roomId)
+float CrewMember_Extend::CalculateDangerThreshold(int roomId)
 {
     std::vector<StatBoost> personalStatBoosts;
     std::unordered_map<int, std::vector<StatBoost*>> stackLimitedStatBoosts;
@@ -2810,7 +2852,7 @@ int CrewMember_Extend::CalculateDangerRating(float health, int roomId)
             return a.def->priority < b.def->priority;
         });
 
-    float dangerRating = -1.f;
+    float threshold = -1.f;
 
     for (auto& statBoost : personalStatBoosts)
     {
@@ -2820,8 +2862,7 @@ int CrewMember_Extend::CalculateDangerRating(float health, int roomId)
         }
         else if (statBoost.iStacks > 0)
         {
-            // we check non stack id stat boosts immediately
-            if (statBoost.def->dangerRating > health) return 0;
+            threshold = std::max(threshold, statBoost.def->dangerRating);
         }
     }
 
@@ -2839,13 +2880,31 @@ int CrewMember_Extend::CalculateDangerRating(float health, int roomId)
 
             if (statBoost->iStacks > 0)
             {
-                // we check stack id stat boosts as we check them
-                if (statBoost->def->dangerRating > health) return 0;
+                threshold = std::max(threshold, statBoost->def->dangerRating);
             }
         }
     }
 
-    return 1;
+    return threshold;
+}
+
+int CrewMember_Extend::CalculateDangerRating(float health, int roomId)
+{
+    // The active danger boosts only change between stat cache frames, so the AI asking about
+    // many rooms for the same crew member reuses the threshold instead of re-sorting the boosts
+    if (roomId < 0) return CalculateDangerThreshold(roomId) > health ? 0 : 1;
+
+    if (dangerThresholdFrame != StatBoostManager::statCacheFrame)
+    {
+        dangerThresholdFrame = StatBoostManager::statCacheFrame;
+        dangerThresholds.clear();
+    }
+    if (roomId >= (int)dangerThresholds.size()) dangerThresholds.resize(roomId + 1, NAN);
+
+    float &threshold = dangerThresholds[roomId];
+    if (std::isnan(threshold)) threshold = CalculateDangerThreshold(roomId);
+
+    return threshold > health ? 0 : 1;
 }
 
 HOOK_METHOD(CrewAI, DangerRating, (int roomId, int crewId) -> int)
@@ -1,7 +1,7 @@
 #include "TemporalSystem.h"
 #include "Room_Extend.h"
+#include "XMLValue.h"
 #include "boost/algorithm/string.hpp"
-#include "boost/lexical_cast.hpp"
 #include <sstream>
 #include <iomanip>
 
@@ -15,19 +15,18 @@ TemporalSystemParser::TemporalLevel ParseTemporalLevel(rapidxml::xml_node<char>*
     for (auto child = node->first_node(); child; child = child->next_sibling())
     {
         std::string name = child->name();
-        std::string val = child->value();
 
         if (name == "cooldown")
         {
-            def.cooldown = boost::lexical_cast<int>(val);
+            def.cooldown = XMLValue::Value<int>(child);
         }
         if (name == "duration")
         {
-            def.duration = boost::lexical_cast<int>(val);
+            def.duration = XMLValue::Value<int>(child);
         }
         if (name == "strength")
         {
-            def.strength = boost::lexical_cast<float>(val);
+            def.strength = XMLValue::Value<float>(child);
         }
     }
 
@@ -44,8 +43,7 @@ void TemporalSystemParser::ParseSystemNode(rapidxml::xml_node<char>* node)
         {
             if (boost::algorithm::starts_with(subChild->name(), "level"))
             {
-                std::string levelStr = std::string(subChild->name()).substr(5);
-                int level = boost::lexical_cast<int>(levelStr);
+                int level = XMLValue::Parse<int>(subChild->name() + 5);
 
                 auto temporalLevel = ParseTemporalLevel(subChild);
 
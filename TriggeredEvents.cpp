@@ -1,6 +1,6 @@
 #include "CustomEvents.h"
 #include "Seeds.h"
-#include <boost/lexical_cast.hpp>
+#include "XMLValue.h"
 #include <boost/algorithm/string.hpp>
 
 std::vector<TriggeredEventDefinition> TriggeredEventDefinition::defs = std::vector<TriggeredEventDefinition>();
@@ -12,7 +12,8 @@ TriggeredEventGui *TriggeredEventGui::instance = new TriggeredEventGui();
 
 std::deque<EventQueueEvent> eventQueue = {};
 
-int TriggeredEvent::playerCloneCount = 0;
+TriggeredEventInputs TriggeredEvent::inputs;
+unsigned int TriggeredEvent::inputsVersion = 1;
 
 void CustomEventsParser::ParseCustomTriggeredEventNode(rapidxml::xml_node<char> *node, TriggeredEventDefinition *def)
 {
@@ -41,155 +42,155 @@ void CustomEventsParser::ParseCustomTriggeredEventNode(rapidxml::xml_node<char>
     }
     if (node->first_attribute("loops"))
     {
-        def->minLoops = boost::lexical_cast<int>(node->first_attribute("loops")->value());
-        def->maxLoops = boost::lexical_cast<int>(node->first_attribute("loops")->value());
+        def->minLoops = XMLValue::Attribute<int>(node, "loops");
+        def->maxLoops = XMLValue::Attribute<int>(node, "loops");
     }
     if (node->first_attribute("minLoops"))
     {
-        def->minLoops = boost::lexical_cast<int>(node->first_attribute("minLoops")->value());
+        def->minLoops = XMLValue::Attribute<int>(node, "minLoops");
     }
     if (node->first_attribute("maxLoops"))
     {
-        def->maxLoops = boost::lexical_cast<int>(node->first_attribute("maxLoops")->value());
+        def->maxLoops = XMLValue::Attribute<int>(node, "maxLoops");
     }
     if (node->first_attribute("time"))
     {
-        def->triggerMinTime = boost::lexical_cast<float>(node->first_attribute("time")->value());
-        def->triggerMaxTime = boost::lexical_cast<float>(node->first_attribute("time")->value());
+        def->triggerMinTime = XMLValue::Attribute<float>(node, "time");
+        def->triggerMaxTime = XMLValue::Attribute<float>(node, "time");
     }
     if (node->first_attribute("minTime"))
     {
-        def->triggerMinTime = boost::lexical_cast<float>(node->first_attribute("minTime")->value());
+        def->triggerMinTime = XMLValue::Attribute<float>(node, "minTime");
     }
     if (node->first_attribute("maxTime"))
     {
-        def->triggerMaxTime = boost::lexical_cast<float>(node->first_attribute("maxTime")->value());
+        def->triggerMaxTime = XMLValue::Attribute<float>(node, "maxTime");
     }
     if (node->first_attribute("jumps"))
     {
-        def->triggerMinJumps = boost::lexical_cast<int>(node->first_attribute("jumps")->value());
-        def->triggerMaxJumps = boost::lexical_cast<int>(node->first_attribute("jumps")->value());
+        def->triggerMinJumps = XMLValue::Attribute<int>(node, "jumps");
+        def->triggerMaxJumps = XMLValue::Attribute<int>(node, "jumps");
     }
     if (node->first_attribute("minJumps"))
     {
-        def->triggerMinJumps = boost::lexical_cast<int>(node->first_attribute("minJumps")->value());
+        def->triggerMinJumps = XMLValue::Attribute<int>(node, "minJumps");
     }
     if (node->first_attribute("maxJumps"))
     {
-        def->triggerMaxJumps = boost::lexical_cast<int>(node->first_attribute("maxJumps")->value());
+        def->triggerMaxJumps = XMLValue::Attribute<int>(node, "maxJumps");
     }
     if (node->first_attribute("playerHull"))
     {
-        def->minPlayerHull = boost::lexical_cast<int>(node->first_attribute("playerHull")->value());
-        def->maxPlayerHull = boost::lexical_cast<int>(node->first_attribute("playerHull")->value());
+        def->minPlayerHull = XMLValue::Attribute<int>(node, "playerHull");
+        def->maxPlayerHull = XMLValue::Attribute<int>(node, "playerHull");
     }
     if (node->first_attribute("minPlayerHull"))
     {
-        def->minPlayerHull = boost::lexical_cast<int>(node->first_attribute("minPlayerHull")->value());
+        def->minPlayerHull = XMLValue::Attribute<int>(node, "minPlayerHull");
     }
     if (node->first_attribute("maxPlayerHull"))
     {
-        def->maxPlayerHull = boost::lexical_cast<int>(node->first_attribute("maxPlayerHull")->value());
+        def->maxPlayerHull = XMLValue::Attribute<int>(node, "maxPlayerHull");
     }
     if (node->first_attribute("playerDamage"))
     {
-        def->minPlayerDamage = boost::lexical_cast<int>(node->first_attribute("playerDamage")->value());
-        def->maxPlayerDamage = boost::lexical_cast<int>(node->first_attribute("playerDamage")->value());
+        def->minPlayerDamage = XMLValue::Attribute<int>(node, "playerDamage");
+        def->maxPlayerDamage = XMLValue::Attribute<int>(node, "playerDamage");
     }
     if (node->first_attribute("minPlayerDamage"))
     {
-        def->minPlayerDamage = boost::lexical_cast<int>(node->first_attribute("minPlayerDamage")->value());
+        def->minPlayerDamage = XMLValue::Attribute<int>(node, "minPlayerDamage");
     }
     if (node->first_attribute("maxPlayerDamage"))
     {
-        def->maxPlayerDamage = boost::lexical_cast<int>(node->first_attribute("maxPlayerDamage")->value());
+        def->maxPlayerDamage = XMLValue::Attribute<int>(node, "maxPlayerDamage");
     }
     if (node->first_attribute("enemyHull"))
     {
-        def->minEnemyHull = boost::lexical_cast<int>(node->first_attribute("enemyHull")->value());
-        def->maxEnemyHull = boost::lexical_cast<int>(node->first_attribute("enemyHull")->value());
+        def->minEnemyHull = XMLValue::Attribute<int>(node, "enemyHull");
+        def->maxEnemyHull = XMLValue::Attribute<int>(node, "enemyHull");
     }
     if (node->first_attribute("minEnemyHull"))
     {
-        def->minEnemyHull = boost::lexical_cast<int>(node->first_attribute("minEnemyHull")->value());
+        def->minEnemyHull = XMLValue::Attribute<int>(node, "minEnemyHull");
     }
     if (node->first_attribute("maxEnemyHull"))
     {
-        def->maxEnemyHull = boost::lexical_cast<int>(node->first_attribute("maxEnemyHull")->value());
+        def->maxEnemyHull = XMLValue::Attribute<int>(node, "maxEnemyHull");
     }
     if (node->first_attribute("enemyDamage"))
     {
-        def->minEnemyDamage = boost::lexical_cast<int>(node->first_attribute("enemyDamage")->value());
-        def->maxEnemyDamage = boost::lexical_cast<int>(node->first_attribute("enemyDamage")->value());
+        def->minEnemyDamage = XMLValue::Attribute<int>(node, "enemyDamage");
+        def->maxEnemyDamage = XMLValue::Attribute<int>(node, "enemyDamage");
     }
     if (node->first_attribute("minEnemyDamage"))
     {
-        def->minEnemyDamage = boost::lexical_cast<int>(node->first_attribute("minEnemyDamage")->value());
+        def->minEnemyDamage = XMLValue::Attribute<int>(node, "minEnemyDamage");
     }
     if (node->first_attribute("maxEnemyDamage"))
     {
-        def->maxEnemyDamage = boost::lexical_cast<int>(node->first_attribute("maxEnemyDamage")->value());
+        def->maxEnemyDamage = XMLValue::Attribute<int>(node, "maxEnemyDamage");
     }
     if (node->first_attribute("enemyHullScaling"))
     {
-        def->enemyHullScaling = boost::lexical_cast<float>(node->first_attribute("enemyHullScaling")->value());
+        def->enemyHullScaling = XMLValue::Attribute<float>(node, "enemyHullScaling");
     }
     if (node->first_attribute("enemyDamageScaling"))
     {
-        def->enemyDamageScaling = boost::lexical_cast<float>(node->first_attribute("enemyDamageScaling")->value());
+        def->enemyDamageScaling = XMLValue::Attribute<float>(node, "enemyDamageScaling");
     }
 
     if (node->first_attribute("playerCrew"))
     {
-        def->minPlayerCrew = boost::lexical_cast<int>(node->first_attribute("playerCrew")->value());
-        def->maxPlayerCrew = boost::lexical_cast<int>(node->first_attribute("playerCrew")->value());
+        def->minPlayerCrew = XMLValue::Attribute<int>(node, "playerCrew");
+        def->maxPlayerCrew = XMLValue::Attribute<int>(node, "playerCrew");
     }
     if (node->first_attribute("minPlayerCrew"))
     {
-        def->minPlayerCrew = boost::lexical_cast<int>(node->first_attribute("minPlayerCrew")->value());
+        def->minPlayerCrew = XMLValue::Attribute<int>(node, "minPlayerCrew");
     }
     if (node->first_attribute("maxPlayerCrew"))
     {
-        def->maxPlayerCrew = boost::lexical_cast<int>(node->first_attribute("maxPlayerCrew")->value());
+        def->maxPlayerCrew = XMLValue::Attribute<int>(node, "maxPlayerCrew");
     }
     if (node->first_attribute("playerDeaths"))
     {
-        def->minPlayerDeaths = boost::lexical_cast<int>(node->first_attribute("playerDeaths")->value());
-        def->maxPlayerDeaths = boost::lexical_cast<int>(node->first_attribute("playerDeaths")->value());
+        def->minPlayerDeaths = XMLValue::Attribute<int>(node, "playerDeaths");
+        def->maxPlayerDeaths = XMLValue::Attribute<int>(node, "playerDeaths");
     }
     if (node->first_attribute("minPlayerDeaths"))
     {
-        def->minPlayerDeaths = boost::lexical_cast<int>(node->first_attribute("minPlayerDeaths")->value());
+        def->minPlayerDeaths = XMLValue::Attribute<int>(node, "minPlayerDeaths");
     }
     if (node->first_attribute("maxPlayerDeaths"))
     {
-        def->maxPlayerDeaths = boost::lexical_cast<int>(node->first_attribute("maxPlayerDeaths")->value());
+        def->maxPlayerDeaths = XMLValue::Attribute<int>(node, "maxPlayerDeaths");
     }
     if (node->first_attribute("enemyCrew"))
     {
-        def->minEnemyCrew = boost::lexical_cast<int>(node->first_attribute("enemyCrew")->value());
-        def->maxEnemyCrew = boost::lexical_cast<int>(node->first_attribute("enemyCrew")->value());
+        def->minEnemyCrew = XMLValue::Attribute<int>(node, "enemyCrew");
+        def->maxEnemyCrew = XMLValue::Attribute<int>(node, "enemyCrew");
     }
     if (node->first_attribute("minEnemyCrew"))
     {
-        def->minEnemyCrew = boost::lexical_cast<int>(node->first_attribute("minEnemyCrew")->value());
+        def->minEnemyCrew = XMLValue::Attribute<int>(node, "minEnemyCrew");
     }
     if (node->first_attribute("maxEnemyCrew"))
     {
-        def->maxEnemyCrew = boost::lexical_cast<int>(node->first_attribute("maxEnemyCrew")->value());
+        def->maxEnemyCrew = XMLValue::Attribute<int>(node, "maxEnemyCrew");
     }
     if (node->first_attribute("enemyDeaths"))
     {
-        def->minEnemyDeaths = boost::lexical_cast<int>(node->first_attribute("enemyDeaths")->value());
-        def->maxEnemyDeaths = boost::lexical_cast<int>(node->first_attribute("enemyDeaths")->value());
+        def->minEnemyDeaths = XMLValue::Attribute<int>(node, "enemyDeaths");
+        def->maxEnemyDeaths = XMLValue::Attribute<int>(node, "enemyDeaths");
     }
     if (node->first_attribute("minEnemyDeaths"))
     {
-        def->minEnemyDeaths = boost::lexical_cast<int>(node->first_attribute("minEnemyDeaths")->value());
+        def->minEnemyDeaths = XMLValue::Attribute<int>(node, "minEnemyDeaths");
     }
     if (node->first_attribute("maxEnemyDeaths"))
     {
-        def->maxEnemyDeaths = boost::lexical_cast<int>(node->first_attribute("maxEnemyDeaths")->value());
+        def->maxEnemyDeaths = XMLValue::Attribute<int>(node, "maxEnemyDeaths");
     }
 
     for (auto child = node->first_node(); child; child = child->next_sibling())
@@ -198,88 +199,88 @@ void CustomEventsParser::ParseCustomTriggeredEventNode(rapidxml::xml_node<char>
         {
             if (child->first_attribute("amount"))
             {
-                def->triggerMinTime = boost::lexical_cast<float>(child->first_attribute("amount")->value());
-                def->triggerMaxTime = boost::lexical_cast<float>(child->first_attribute("amount")->value());
+                def->triggerMinTime = XMLValue::Attribute<float>(child, "amount");
+                def->triggerMaxTime = XMLValue::Attribute<float>(child, "amount");
             }
             if (child->first_attribute("min"))
             {
-                def->triggerMinTime = boost::lexical_cast<float>(child->first_attribute("min")->value());
+                def->triggerMinTime = XMLValue::Attribute<float>(child, "min");
             }
             if (child->first_attribute("max"))
             {
-                def->triggerMaxTime = boost::lexical_cast<float>(child->first_attribute("max")->value());
+                def->triggerMaxTime = XMLValue::Attribute<float>(child, "max");
             }
         }
         if (strcmp(child->name(), "jumps") == 0)
         {
             if (child->first_attribute("amount"))
             {
-                def->triggerMinJumps = boost::lexical_cast<int>(child->first_attribute("amount")->value());
-                def->triggerMaxJumps = boost::lexical_cast<int>(child->first_attribute("amount")->value());
+                def->triggerMinJumps = XMLValue::Attribute<int>(child, "amount");
+                def->triggerMaxJumps = XMLValue::Attribute<int>(child, "amount");
             }
             if (child->first_attribute("min"))
             {
-                def->triggerMinJumps = boost::lexical_cast<int>(child->first_attribute("min")->value());
+                def->triggerMinJumps = XMLValue::Attribute<int>(child, "min");
             }
             if (child->first_attribute("max"))
             {
-                def->triggerMaxJumps = boost::lexical_cast<int>(child->first_attribute("max")->value());
+                def->triggerMaxJumps = XMLValue::Attribute<int>(child, "max");
             }
             if (child->first_attribute("type"))
             {
-                def->jumpType = boost::lexical_cast<int>(child->first_attribute("type")->value());
+                def->jumpType = XMLValue::Attribute<int>(child, "type");
             }
         }
         if (strcmp(child->name(), "playerHull") == 0)
         {
             if (child->first_attribute("amount"))
             {
-                def->minPlayerHull = boost::lexical_cast<int>(child->first_attribute("amount")->value());
-                def->maxPlayerHull = boost::lexical_cast<int>(child->first_attribute("amount")->value());
+                def->minPlayerHull = XMLValue::Attribute<int>(child, "amount");
+                def->maxPlayerHull = XMLValue::Attribute<int>(child, "amount");
             }
             if (child->first_attribute("min"))
             {
-                def->minPlayerHull = boost::lexical_cast<int>(child->first_attribute("min")->value());
+                def->minPlayerHull = XMLValue::Attribute<int>(child, "min");
             }
             if (child->first_attribute("max"))
             {
-                def->maxPlayerHull = boost::lexical_cast<int>(child->first_attribute("max")->value());
+                def->maxPlayerHull = XMLValue::Attribute<int>(child, "max");
             }
         }
         if (strcmp(child->name(), "enemyHull") == 0)
         {
             if (child->first_attribute("amount"))
             {
-                def->minEnemyHull = boost::lexical_cast<int>(child->first_attribute("amount")->value());
-                def->maxEnemyHull = boost::lexical_cast<int>(child->first_attribute("amount")->value());
+                def->minEnemyHull = XMLValue::Attribute<int>(child, "amount");
+                def->maxEnemyHull = XMLValue::Attribute<int>(child, "amount");
             }
             if (child->first_attribute("min"))
             {
-                def->minEnemyHull = boost::lexical_cast<int>(child->first_attribute("min")->value());
+                def->minEnemyHull = XMLValue::Attribute<int>(child, "min");
             }
             if (child->first_attribute("max"))
             {
-                def->maxEnemyHull = boost::lexical_cast<int>(child->first_attribute("max")->value());
+                def->maxEnemyHull = XMLValue::Attribute<int>(child, "max");
             }
             if (child->first_attribute("scaling"))
             {
-                def->enemyHullScaling = boost::lexical_cast<float>(child->first_attribute("scaling")->value());
+                def->enemyHullScaling = XMLValue::Attribute<float>(child, "scaling");
             }
         }
         if (strcmp(child->name(), "playerDamage") == 0)
         {
             if (child->first_attribute("amount"))
             {
-                def->minPlayerDamage = boost::lexical_cast<int>(child->first_attribute("amount")->value());
-                def->maxPlayerDamage = boost::lexical_cast<int>(child->first_attribute("amount")->value());
+                def->minPlayerDamage = XMLValue::Attribute<int>(child, "amount");
+                def->maxPlayerDamage = XMLValue::Attribute<int>(child, "amount");
             }
             if (child->first_attribute("min"))
             {
-                def->minPlayerDamage = boost::lexical_cast<int>(child->first_attribute("min")->value());
+                def->minPlayerDamage = XMLValue::Attribute<int>(child, "min");
             }
             if (child->first_attribute("max"))
             {
-                def->maxPlayerDamage = boost::lexical_cast<int>(child->first_attribute("max")->value());
+                def->maxPlayerDamage = XMLValue::Attribute<int>(child, "max");
             }
             if (child->first_attribute("countRepairs"))
             {
@@ -290,20 +291,20 @@ void CustomEventsParser::ParseCustomTriggeredEventNode(rapidxml::xml_node<char>
         {
             if (child->first_attribute("amount"))
             {
-                def->minEnemyDamage = boost::lexical_cast<int>(child->first_attribute("amount")->value());
-                def->maxEnemyDamage = boost::lexical_cast<int>(child->first_attribute("amount")->value());
+                def->minEnemyDamage = XMLValue::Attribute<int>(child, "amount");
+                def->maxEnemyDamage = XMLValue::Attribute<int>(child, "amount");
             }
             if (child->first_attribute("min"))
             {
-                def->minEnemyDamage = boost::lexical_cast<int>(child->first_attribute("min")->value());
+                def->minEnemyDamage = XMLValue::Attribute<int>(child, "min");
             }
             if (child->first_attribute("max"))
             {
-                def->maxEnemyDamage = boost::lexical_cast<int>(child->first_attribute("max")->value());
+                def->maxEnemyDamage = XMLValue::Attribute<int>(child, "max");
             }
             if (child->first_attribute("scaling"))
             {
-                def->enemyDamageScaling = boost::lexical_cast<float>(child->first_attribute("scaling")->value());
+                def->enemyDamageScaling = XMLValue::Attribute<float>(child, "scaling");
             }
             if (child->first_attribute("countRepairs"))
             {
@@ -314,16 +315,16 @@ void CustomEventsParser::ParseCustomTriggeredEventNode(rapidxml::xml_node<char>
         {
             if (child->first_attribute("amount"))
             {
-                def->minPlayerCrew = boost::lexical_cast<int>(child->first_attribute("amount")->value());
-                def->maxPlayerCrew = boost::lexical_cast<int>(child->first_attribute("amount")->value());
+                def->minPlayerCrew = XMLValue::Attribute<int>(child, "amount");
+                def->maxPlayerCrew = XMLValue::Attribute<int>(child, "amount");
             }
             if (child->first_attribute("min"))
             {
-                def->minPlayerCrew = boost::lexical_cast<int>(child->first_attribute("min")->value());
+                def->minPlayerCrew = XMLValue::Attribute<int>(child, "min");
             }
             if (child->first_attribute("max"))
             {
-                def->maxPlayerCrew = boost::lexical_cast<int>(child->first_attribute("max")->value());
+                def->maxPlayerCrew = XMLValue::Attribute<int>(child, "max");
             }
             if (child->first_attribute("includeClonebay"))
             {
@@ -334,16 +335,16 @@ void CustomEventsParser::ParseCustomTriggeredEventNode(rapidxml::xml_node<char>
         {
             if (child->first_attribute("amount"))
             {
-                def->minEnemyCrew = boost::lexical_cast<int>(child->first_attribute("amount")->value());
-                def->maxEnemyCrew = boost::lexical_cast<int>(child->first_attribute("amount")->value());
+                def->minEnemyCrew = XMLValue::Attribute<int>(child, "amount");
+                def->maxEnemyCrew = XMLValue::Attribute<int>(child, "amount");
             }
             if (child->first_attribute("min"))
             {
-                def->minEnemyCrew = boost::lexical_cast<int>(child->first_attribute("min")->value());
+                def->minEnemyCrew = XMLValue::Attribute<int>(child, "min");
             }
             if (child->first_attribute("max"))
             {
-                def->maxEnemyCrew = boost::lexical_cast<int>(child->first_attribute("max")->value());
+                def->maxEnemyCrew = XMLValue::Attribute<int>(child, "max");
             }
             if (child->first_attribute("includeClonebay"))
             {
@@ -354,16 +355,16 @@ void CustomEventsParser::ParseCustomTriggeredEventNode(rapidxml::xml_node<char>
         {
             if (child->first_attribute("amount"))
             {
-                def->minPlayerDeaths = boost::lexical_cast<int>(child->first_attribute("amount")->value());
-                def->maxPlayerDeaths = boost::lexical_cast<int>(child->first_attribute("amount")->value());
+                def->minPlayerDeaths = XMLValue::Attribute<int>(child, "amount");
+                def->maxPlayerDeaths = XMLValue::Attribute<int>(child, "amount");
             }
             if (child->first_attribute("min"))
             {
-                def->minPlayerDeaths = boost::lexical_cast<int>(child->first_attribute("min")->value());
+                def->minPlayerDeaths = XMLValue::Attribute<int>(child, "min");
             }
             if (child->first_attribute("max"))
             {
-                def->maxPlayerDeaths = boost::lexical_cast<int>(child->first_attribute("max")->value());
+                def->maxPlayerDeaths = XMLValue::Attribute<int>(child, "max");
             }
             if (child->first_attribute("countNewCrew"))
             {
@@ -378,16 +379,16 @@ void CustomEventsParser::ParseCustomTriggeredEventNode(rapidxml::xml_node<char>
         {
             if (child->first_attribute("amount"))
             {
-                def->minEnemyDeaths = boost::lexical_cast<int>(child->first_attribute("amount")->value());
-                def->maxEnemyDeaths = boost::lexical_cast<int>(child->first_attribute("amount")->value());
+                def->minEnemyDeaths = XMLValue::Attribute<int>(child, "amount");
+                def->maxEnemyDeaths = XMLValue::Attribute<int>(child, "amount");
             }
             if (child->first_attribute("min"))
             {
-                def->minEnemyDeaths = boost::lexical_cast<int>(child->first_attribute("min")->value());
+                def->minEnemyDeaths = XMLValue::Attribute<int>(child, "min");
             }
             if (child->first_attribute("max"))
             {
-                def->maxEnemyDeaths = boost::lexical_cast<int>(child->first_attribute("max")->value());
+                def->maxEnemyDeaths = XMLValue::Attribute<int>(child, "max");
             }
             if (child->first_attribute("countNewCrew"))
             {
@@ -413,14 +414,14 @@ void CustomEventsParser::ParseCustomTriggeredEventNode(rapidxml::xml_node<char>
             if (child->first_attribute("lvl"))
             {
                 hasMinLevel = true;
-                def->reqMinLvl.first = boost::lexical_cast<int>(child->first_attribute("lvl")->value());
-                def->reqMinLvl.second = boost::lexical_cast<int>(child->first_attribute("lvl")->value());
+                def->reqMinLvl.first = XMLValue::Attribute<int>(child, "lvl");
+                def->reqMinLvl.second = XMLValue::Attribute<int>(child, "lvl");
             }
             if (child->first_attribute("max_lvl"))
             {
                 hasMaxLevel = true;
-                def->reqMaxLvl.first = boost::lexical_cast<int>(child->first_attribute("max_lvl")->value());
-                def->reqMaxLvl.second = boost::lexical_cast<int>(child->first_attribute("max_lvl")->value());
+                def->reqMaxLvl.first = XMLValue::Attribute<int>(child, "max_lvl");
+                def->reqMaxLvl.second = XMLValue::Attribute<int>(child, "max_lvl");
             }
             for (auto reqChild = child->first_node(); reqChild; reqChild = reqChild->next_sibling())
             {
@@ -429,16 +430,16 @@ void CustomEventsParser::ParseCustomTriggeredEventNode(rapidxml::xml_node<char>
                     hasMinLevel = true;
                     if (reqChild->first_attribute("amount"))
                     {
-                        def->reqMinLvl.first = boost::lexical_cast<int>(reqChild->first_attribute("amount")->value());
-                        def->reqMinLvl.second = boost::lexical_cast<int>(reqChild->first_attribute("amount")->value());
+                        def->reqMinLvl.first = XMLValue::Attribute<int>(reqChild, "amount");
+                        def->reqMinLvl.second = XMLValue::Attribute<int>(reqChild, "amount");
                     }
                     if (reqChild->first_attribute("min"))
                     {
-                        def->reqMinLvl.first = boost::lexical_cast<int>(reqChild->first_attribute("min")->value());
+                        def->reqMinLvl.first = XMLValue::Attribute<int>(reqChild, "min");
                     }
                     if (reqChild->first_attribute("max"))
                     {
-                        def->reqMinLvl.second = boost::lexical_cast<int>(reqChild->first_attribute("max")->value());
+                        def->reqMinLvl.second = XMLValue::Attribute<int>(reqChild, "max");
                     }
                 }
                 if (strcmp(reqChild->name(), "max_lvl") == 0)
@@ -446,16 +447,16 @@ void CustomEventsParser::ParseCustomTriggeredEventNode(rapidxml::xml_node<char>
                     hasMaxLevel = true;
                     if (reqChild->first_attribute("amount"))
                     {
-                        def->reqMaxLvl.first = boost::lexical_cast<int>(reqChild->first_attribute("amount")->value());
-                        def->reqMaxLvl.second = boost::lexical_cast<int>(reqChild->first_attribute("amount")->value());
+                        def->reqMaxLvl.first = XMLValue::Attribute<int>(reqChild, "amount");
+                        def->reqMaxLvl.second = XMLValue::Attribute<int>(reqChild, "amount");
                     }
                     if (reqChild->first_attribute("min"))
                     {
-                        def->reqMaxLvl.first = boost::lexical_cast<int>(reqChild->first_attribute("min")->value());
+                        def->reqMaxLvl.first = XMLValue::Attribute<int>(reqChild, "min");
                     }
                     if (reqChild->first_attribute("max"))
                     {
-                        def->reqMaxLvl.second = boost::lexical_cast<int>(reqChild->first_attribute("max")->value());
+                        def->reqMaxLvl.second = XMLValue::Attribute<int>(reqChild, "max");
                     }
                 }
             }
@@ -552,7 +553,7 @@ void CustomEventsParser::ParseCustomTriggeredEventBoxNode(rapidxml::xml_node<cha
     }
     if (node->first_attribute("priority"))
     {
-        box->priority = boost::lexical_cast<int>(node->first_attribute("priority")->value());
+        box->priority = XMLValue::Attribute<int>(node, "priority");
     }
     for (auto child = node->first_node(); child; child = child->next_sibling())
     {
@@ -565,51 +566,51 @@ void CustomEventsParser::ParseCustomTriggeredEventBoxNode(rapidxml::xml_node<cha
             }
             if (child->first_attribute("x"))
             {
-                box->x = boost::lexical_cast<int>(child->first_attribute("x")->value());
+                box->x = XMLValue::Attribute<int>(child, "x");
             }
             if (child->first_attribute("y"))
             {
-                box->y = boost::lexical_cast<int>(child->first_attribute("y")->value());
+                box->y = XMLValue::Attribute<int>(child, "y");
             }
             if (child->first_attribute("w"))
             {
-                box->w = boost::lexical_cast<int>(child->first_attribute("w")->value());
+                box->w = XMLValue::Attribute<int>(child, "w");
             }
             if (child->first_attribute("h"))
             {
-                box->h = boost::lexical_cast<int>(child->first_attribute("h")->value());
+                box->h = XMLValue::Attribute<int>(child, "h");
             }
             if (child->first_attribute("left"))
             {
-                box->left = boost::lexical_cast<int>(child->first_attribute("left")->value());
+                box->left = XMLValue::Attribute<int>(child, "left");
             }
             if (child->first_attribute("right"))
             {
-                box->right = boost::lexical_cast<int>(child->first_attribute("right")->value());
+                box->right = XMLValue::Attribute<int>(child, "right");
             }
             if (child->first_attribute("top"))
             {
-                box->top = boost::lexical_cast<int>(child->first_attribute("top")->value());
+                box->top = XMLValue::Attribute<int>(child, "top");
             }
             if (child->first_attribute("bottom"))
             {
-                box->bottom = boost::lexical_cast<int>(child->first_attribute("bottom")->value());
+                box->bottom = XMLValue::Attribute<int>(child, "bottom");
             }
             if (child->first_attribute("r"))
             {
-                box->imageColor.r = boost::lexical_cast<float>(child->first_attribute("r")->value()) / 255.f;
+                box->imageColor.r = XMLValue::Attribute<float>(child, "r") / 255.f;
             }
             if (child->first_attribute("g"))
             {
-                box->imageColor.g = boost::lexical_cast<float>(child->first_attribute("g")->value()) / 255.f;
+                box->imageColor.g = XMLValue::Attribute<float>(child, "g") / 255.f;
             }
             if (child->first_attribute("b"))
             {
-                box->imageColor.b = boost::lexical_cast<float>(child->first_attribute("b")->value()) / 255.f;
+                box->imageColor.b = XMLValue::Attribute<float>(child, "b") / 255.f;
             }
             if (child->first_attribute("a"))
             {
-                box->imageColor.a = boost::lexical_cast<float>(child->first_attribute("a")->value());
+                box->imageColor.a = XMLValue::Attribute<float>(child, "a");
             }
         }
         if (nodeName == "image2")
@@ -620,19 +621,19 @@ void CustomEventsParser::ParseCustomTriggeredEventBoxNode(rapidxml::xml_node<cha
             }
             if (child->first_attribute("r"))
             {
-                box->imageColor2.r = boost::lexical_cast<float>(child->first_attribute("r")->value()) / 255.f;
+                box->imageColor2.r = XMLValue::Attribute<float>(child, "r") / 255.f;
             }
             if (child->first_attribute("g"))
             {
-                box->imageColor2.g = boost::lexical_cast<float>(child->first_attribute("g")->value()) / 255.f;
+                box->imageColor2.g = XMLValue::Attribute<float>(child, "g") / 255.f;
             }
             if (child->first_attribute("b"))
             {
-                box->imageColor2.b = boost::lexical_cast<float>(child->first_attribute("b")->value()) / 255.f;
+                box->imageColor2.b = XMLValue::Attribute<float>(child, "b") / 255.f;
             }
             if (child->first_attribute("a"))
             {
-                box->imageColor2.a = boost::lexical_cast<float>(child->first_attribute("a")->value());
+                box->imageColor2.a = XMLValue::Attribute<float>(child, "a");
             }
         }
         if (nodeName == "icon")
@@ -643,27 +644,27 @@ void CustomEventsParser::ParseCustomTriggeredEventBoxNode(rapidxml::xml_node<cha
             }
             if (child->first_attribute("x"))
             {
-                box->front_x = boost::lexical_cast<int>(child->first_attribute("x")->value());
+                box->front_x = XMLValue::Attribute<int>(child, "x");
             }
             if (child->first_attribute("y"))
             {
-                box->front_y = boost::lexical_cast<int>(child->first_attribute("y")->value());
+                box->front_y = XMLValue::Attribute<int>(child, "y");
             }
             if (child->first_attribute("r"))
             {
-                box->imageColorFront.r = boost::lexical_cast<float>(child->first_attribute("r")->value()) / 255.f;
+                box->imageColorFront.r = XMLValue::Attribute<float>(child, "r") / 255.f;
             }
             if (child->first_attribute("g"))
             {
-                box->imageColorFront.g = boost::lexical_cast<float>(child->first_attribute("g")->value()) / 255.f;
+                box->imageColorFront.g = XMLValue::Attribute<float>(child, "g") / 255.f;
             }
             if (child->first_attribute("b"))
             {
-                box->imageColorFront.b = boost::lexical_cast<float>(child->first_attribute("b")->value()) / 255.f;
+                box->imageColorFront.b = XMLValue::Attribute<float>(child, "b") / 255.f;
             }
             if (child->first_attribute("a"))
             {
-                box->imageColorFront.a = boost::lexical_cast<float>(child->first_attribute("a")->value());
+                box->imageColorFront.a = XMLValue::Attribute<float>(child, "a");
             }
         }
         if (nodeName == "text")
@@ -699,57 +700,57 @@ void CustomEventsParser::ParseCustomTriggeredEventBoxNode(rapidxml::xml_node<cha
             }
             if (child->first_attribute("x"))
             {
-                box->text_x = boost::lexical_cast<int>(child->first_attribute("x")->value());
+                box->text_x = XMLValue::Attribute<int>(child, "x");
             }
             if (child->first_attribute("y"))
             {
-                box->text_y = boost::lexical_cast<int>(child->first_attribute("y")->value());
+                box->text_y = XMLValue::Attribute<int>(child, "y");
             }
             if (child->first_attribute("r"))
             {
-                box->textColor.r = boost::lexical_cast<float>(child->first_attribute("r")->value()) / 255.f;
+                box->textColor.r = XMLValue::Attribute<float>(child, "r") / 255.f;
             }
             if (child->first_attribute("g"))
             {
-                box->textColor.g = boost::lexical_cast<float>(child->first_attribute("g")->value()) / 255.f;
+                box->textColor.g = XMLValue::Attribute<float>(child, "g") / 255.f;
             }
             if (child->first_attribute("b"))
             {
-                box->textColor.b = boost::lexical_cast<float>(child->first_attribute("b")->value()) / 255.f;
+                box->textColor.b = XMLValue::Attribute<float>(child, "b") / 255.f;
             }
             if (child->first_attribute("a"))
             {
-                box->textColor.a = boost::lexical_cast<float>(child->first_attribute("a")->value());
+                box->textColor.a = XMLValue::Attribute<float>(child, "a");
             }
         }
         if (nodeName == "text2")
         {
             if (child->first_attribute("r"))
             {
-                box->textColor2.r = boost::lexical_cast<float>(child->first_attribute("r")->value()) / 255.f;
+                box->textColor2.r = XMLValue::Attribute<float>(child, "r") / 255.f;
             }
             if (child->first_attribute("g"))
             {
-                box->textColor2.g = boost::lexical_cast<float>(child->first_attribute("g")->value()) / 255.f;
+                box->textColor2.g = XMLValue::Attribute<float>(child, "g") / 255.f;
             }
             if (child->first_attribute("b"))
             {
-                box->textColor2.b = boost::lexical_cast<float>(child->first_attribute("b")->value()) / 255.f;
+                box->textColor2.b = XMLValue::Attribute<float>(child, "b") / 255.f;
             }
             if (child->first_attribute("a"))
             {
-                box->textColor2.a = boost::lexical_cast<float>(child->first_attribute("a")->value());
+                box->textColor2.a = XMLValue::Attribute<float>(child, "a");
             }
         }
         if (nodeName == "warning")
         {
             if (child->first_attribute("time"))
             {
-                box->warningTime = boost::lexical_cast<float>(child->first_attribute("time")->value());
+                box->warningTime = XMLValue::Attribute<float>(child, "time");
             }
             if (child->first_attribute("jumps"))
             {
-                box->warningJumps = boost::lexical_cast<int>(child->first_attribute("jumps")->value());
+                box->warningJumps = XMLValue::Attribute<int>(child, "jumps");
             }
             if (child->first_attribute("flash"))
             {
@@ -782,7 +783,7 @@ void CustomEventsParser::ParseCustomTriggeredEventSounds(rapidxml::xml_node<char
             timerSound.second = child->value();
             if (child->first_attribute("t"))
             {
-                timerSound.first = boost::lexical_cast<float>(child->first_attribute("t")->value());
+                timerSound.first = XMLValue::Attribute<float>(child, "t");
             }
             vec->push_back(timerSound);
         }
@@ -810,16 +811,16 @@ void CustomEventsParser::ParseCustomTriggeredEventWarningNode(rapidxml::xml_node
 
     if (node->first_attribute("x"))
     {
-        warning->position.x = boost::lexical_cast<int>(node->first_attribute("x")->value());
+        warning->position.x = XMLValue::Attribute<int>(node, "x");
     }
     if (node->first_attribute("y"))
     {
-        warning->position.y = boost::lexical_cast<int>(node->first_attribute("y")->value());
+        warning->position.y = XMLValue::Attribute<int>(node, "y");
     }
 
     if (node->first_attribute("time"))
     {
-        warning->time = boost::lexical_cast<float>(node->first_attribute("time")->value());
+        warning->time = XMLValue::Attribute<float>(node, "time");
     }
 
     if (node->first_attribute("centerText"))
@@ -834,15 +835,15 @@ void CustomEventsParser::ParseCustomTriggeredEventWarningNode(rapidxml::xml_node
 
     if (node->first_attribute("r"))
     {
-        warning->textColor.r = boost::lexical_cast<float>(node->first_attribute("r")->value());
+        warning->textColor.r = XMLValue::Attribute<float>(node, "r");
     }
     if (node->first_attribute("g"))
     {
-        warning->textColor.g = boost::lexical_cast<float>(node->first_attribute("g")->value());
+        warning->textColor.g = XMLValue::Attribute<float>(node, "g");
     }
     if (node->first_attribute("b"))
     {
-        warning->textColor.b = boost::lexical_cast<float>(node->first_attribute("b")->value());
+        warning->textColor.b = XMLValue::Attribute<float>(node, "b");
     }
 
     if (node->first_attribute("sound"))
@@ -890,14 +891,34 @@ void TriggeredEvent::DestroyEvent(const std::string& name)
     }
 }
 
-void TriggeredEvent::UpdateAll()
+void TriggeredEvent::UpdateInputs()
 {
-    playerCloneCount = 0;
+    TriggeredEventInputs newInputs;
+
     for (auto& crew : G_->GetCrewFactory()->crewMembers)
     {
-        if (crew->iShipId == 0 && crew->CountForVictory() && crew->bOutOfGame && crew->clone_ready) playerCloneCount++;
+        if (crew->iShipId == 0 && crew->CountForVictory() && crew->bOutOfGame && crew->clone_ready) newInputs.playerCloneCount++;
     }
 
+    newInputs.playerShip = G_->GetShipManager(0);
+    newInputs.enemyShip = G_->GetShipManager(1);
+    if (newInputs.playerShip != nullptr) newInputs.playerHull = newInputs.playerShip->ship.hullIntegrity.first;
+    if (newInputs.enemyShip != nullptr) newInputs.enemyHull = newInputs.enemyShip->ship.hullIntegrity.first;
+    newInputs.playerCrew = G_->GetCrewFactory()->playerCrew;
+    newInputs.enemyCrew = G_->GetCrewFactory()->enemyCrew;
+    newInputs.enemyCloneCount = G_->GetCrewFactory()->enemyCloneCount;
+
+    if (newInputs != inputs)
+    {
+        inputs = newInputs;
+        if (++inputsVersion == 0) inputsVersion = 1;
+    }
+}
+
+void TriggeredEvent::UpdateAll()
+{
+    if (!eventList.empty()) UpdateInputs();
+
     for (auto it=eventList.begin(); it!=eventList.end(); )
     {
         if (it->second.def->thisFight)
@@ -1002,6 +1023,10 @@ void TriggeredEvent::TriggerCheck()
 
 void TriggeredEvent::Reset()
 {
+    // new events can be created before UpdateAll has gathered any inputs, so the crew counts below must be current
+    UpdateInputs();
+    checkedInputsVersion = 0;
+
     if (triggerTimer != nullptr)
     {
         float goal = def->triggerMinTime;
@@ -1122,7 +1147,7 @@ void TriggeredEvent::Reset()
     triggerPlayerDeaths = -1;
     if (def->minPlayerDeaths > -1)
     {
-        currentPlayerCrew = GetPlayerCrew(def->playerDeathsCountClonebay);
+        currentPlayerCrew = inputs.GetPlayerCrew(def->playerDeathsCountClonebay);
         if (def->maxPlayerDeaths > def->minPlayerDeaths)
         {
             triggerPlayerDeaths = def->minPlayerDeaths + random32()%(def->maxPlayerDeaths-def->minPlayerDeaths+1);
@@ -1136,7 +1161,7 @@ void TriggeredEvent::Reset()
     triggerEnemyDeaths = -1;
     if (def->minEnemyDeaths > -1)
     {
-        currentEnemyCrew = GetEnemyCrew(def->enemyDeathsCountClonebay);
+        currentEnemyCrew = inputs.GetEnemyCrew(def->enemyDeathsCountClonebay);
         if (def->maxEnemyDeaths > def->minEnemyDeaths)
         {
             triggerEnemyDeaths = def->minEnemyDeaths + random32()%(def->maxEnemyDeaths-def->minEnemyDeaths+1);
@@ -1193,46 +1218,34 @@ void TriggeredEvent::Update()
         }
     }
 
-    if (triggerPlayerHull >= 0)
+    // Hull and crew conditions only depend on the per-frame inputs, so they are skipped while those stay the same
+    if (checkedInputsVersion != inputsVersion)
     {
-        ship = G_->GetShipManager(0);
-        if (ship != nullptr)
+        checkedInputsVersion = inputsVersion;
+
+        if (triggerPlayerHull >= 0 && inputs.playerShip != nullptr && inputs.playerHull <= triggerPlayerHull)
         {
-            if (ship->ship.hullIntegrity.first <= triggerPlayerHull)
-            {
-                triggered = true;
-            }
+            triggered = true;
         }
-    }
 
-    if (triggerEnemyHull >= 0)
-    {
-        ship = G_->GetShipManager(1);
-        if (ship != nullptr)
+        if (triggerEnemyHull >= 0 && inputs.enemyShip != nullptr && inputs.enemyHull <= triggerEnemyHull)
         {
-            if (ship->ship.hullIntegrity.first <= triggerEnemyHull)
-            {
-                triggered = true;
-            }
+            triggered = true;
         }
-    }
 
-    if (triggerPlayerCrew >= 0 && GetPlayerCrew(def->playerCrewCountClonebay) <= triggerPlayerCrew)
-    {
-        triggered = true;
-    }
+        if (triggerPlayerCrew >= 0 && inputs.GetPlayerCrew(def->playerCrewCountClonebay) <= triggerPlayerCrew)
+        {
+            triggered = true;
+        }
 
-    if (triggerEnemyCrew >= 0 && GetEnemyCrew(def->enemyCrewCountClonebay) <= triggerEnemyCrew)
-    {
-        triggered = true;
-    }
+        if (triggerEnemyCrew >= 0 && inputs.GetEnemyCrew(def->enemyCrewCountClonebay) <= triggerEnemyCrew)
+        {
+            triggered = true;
+        }
 
-    if (triggerPlayerDamage >= 0)
-    {
-        ship = G_->GetShipManager(0);
-        if (ship != nullptr)
+        if (triggerPlayerDamage >= 0 && inputs.playerShip != nullptr)
         {
-            int hull = ship->ship.hullIntegrity.first;
+            int hull = inputs.playerHull;
             int change = currentPlayerHull - hull;
             if (change<0 && !def->playerCountRepairs) change=0;
             currentPlayerHull = hull;
@@ -1242,14 +1255,10 @@ void TriggeredEvent::Update()
                 triggered = true;
             }
         }
-    }
 
-    if (triggerEnemyDamage >= 0)
-    {
-        ship = G_->GetShipManager(1);
-        if (ship != nullptr)
+        if (triggerEnemyDamage >= 0 && inputs.enemyShip != nullptr)
         {
-            int hull = ship->ship.hullIntegrity.first;
+            int hull = inputs.enemyHull;
             int change = currentEnemyHull - hull;
             if (change<0 && !def->enemyCountRepairs) change=0;
             currentEnemyHull = hull;
@@ -1259,31 +1268,31 @@ void TriggeredEvent::Update()
                 triggered = true;
             }
         }
-    }
 
-    if (triggerPlayerDeaths >= 0)
-    {
-        int crew = GetPlayerCrew(def->playerDeathsCountClonebay);
-        int change = currentPlayerCrew - crew;
-        if (change<0 && !def->playerCountNewCrew) change=0;
-        currentPlayerCrew = crew;
-        triggerPlayerDeaths -= change;
-        if (triggerPlayerDeaths <= 0)
+        if (triggerPlayerDeaths >= 0)
         {
-            triggered = true;
+            int crew = inputs.GetPlayerCrew(def->playerDeathsCountClonebay);
+            int change = currentPlayerCrew - crew;
+            if (change<0 && !def->playerCountNewCrew) change=0;
+            currentPlayerCrew = crew;
+            triggerPlayerDeaths -= change;
+            if (triggerPlayerDeaths <= 0)
+            {
+                triggered = true;
+            }
         }
-    }
 
-    if (triggerEnemyDeaths >= 0)
-    {
-        int crew = GetEnemyCrew(def->enemyDeathsCountClonebay);
-        int change = currentEnemyCrew - crew;
-        if (change<0 && !def->enemyCountNewCrew) change=0;
-        currentEnemyCrew = crew;
-        triggerEnemyDeaths -= change;
-        if (triggerEnemyDeaths <= 0)
+        if (triggerEnemyDeaths >= 0)
         {
-            triggered = true;
+            int crew = inputs.GetEnemyCrew(def->enemyDeathsCountClonebay);
+            int change = currentEnemyCrew - crew;
+            if (change<0 && !def->enemyCountNewCrew) change=0;
+            currentEnemyCrew = crew;
+            triggerEnemyDeaths -= change;
+            if (triggerEnemyDeaths <= 0)
+            {
+                triggered = true;
+            }
         }
     }
 
@@ -1383,6 +1392,7 @@ void TriggeredEvent::Save(int file)
 void TriggeredEvent::Load(int file)
 {
     // def is read in LoadAll
+    checkedInputsVersion = 0;
     seed = FileHelper::readInteger(file);
     loops = FileHelper::readInteger(file);
     if (triggerTimer != nullptr)
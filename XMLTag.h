@@ -0,0 +1,47 @@
+#pragma once
+#include "Global.h"
+#include <cstdint>
+#include <string>
+
+// Hashed dispatch on XML tag names for parsers with long lists of tags.
+// The case labels are hashed at compile time, so two tags with the same hash fail to compile,
+// and HS_XML_TAG compares the name once more so an unknown tag can never land in a case by accident.
+//
+//     switch (XMLTag::Hash(name))
+//     {
+//     HS_XML_TAG(name, "maxHealth")
+//     {
+//         ...
+//     }
+//     break;
+//     default:
+//         XMLTag::Unknown("crew", name);
+//     }
+class XMLTag
+{
+public:
+    // FNV-1a
+    static constexpr uint32_t Hash(const char* name, uint32_t hash = 2166136261u)
+    {
+        return *name ? Hash(name + 1, (hash ^ (unsigned char)*name) * 16777619u) : hash;
+    }
+
+    static uint32_t Hash(const std::string& name)
+    {
+        uint32_t hash = 2166136261u;
+        for (char c : name)
+        {
+            hash = (hash ^ (unsigned char)c) * 16777619u;
+        }
+        return hash;
+    }
+
+    static void Unknown(const char* parent, const std::string& name)
+    {
+        hs_log_file("Ignoring unknown tag <%s> in <%s>\n", name.c_str(), parent);
+    }
+};
+
+#define HS_XML_TAG(name, tag) \
+    case XMLTag::Hash(tag): \
+        if (name != tag) break;
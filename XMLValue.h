@@ -0,0 +1,89 @@
+#pragma once
+#include "rapidxml.hpp"
+#include <boost/lexical_cast/bad_lexical_cast.hpp>
+#include <cctype>
+#include <cerrno>
+#include <climits>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+// Thrown for XML values that can't be converted.
+// Derives from bad_lexical_cast so handlers written for boost::lexical_cast still catch it.
+class XMLValueError : public boost::bad_lexical_cast
+{
+public:
+    XMLValueError(const std::string& _message) : message{_message} {}
+
+    const char* what() const noexcept override
+    {
+        return message.c_str();
+    }
+
+private:
+    std::string message;
+};
+
+// Numeric conversion of rapidxml attribute and node values, read straight from the parsed buffer.
+// Accepts the same text as boost::lexical_cast for these types: no surrounding whitespace or trailing characters.
+class XMLValue
+{
+public:
+    static bool Parse(const char* text, int& out)
+    {
+        long long value;
+        if (!ParseInteger(text, value) || value < INT_MIN || value > INT_MAX) return false;
+        out = value;
+        return true;
+    }
+
+    static bool Parse(const char* text, float& out)
+    {
+        if (*text == '\0' || isspace((unsigned char)*text) || strpbrk(text, "xX") != nullptr) return false;
+        char* end;
+        errno = 0;
+        out = strtof(text, &end);
+        if (errno == ERANGE && std::isinf(out)) return false;
+        return end != text && *end == '\0';
+    }
+
+    template<typename T>
+    static T Parse(const char* text)
+    {
+        T ret;
+        if (!Parse(text, ret)) throw XMLValueError(std::string("Invalid value \"") + text + "\"");
+        return ret;
+    }
+
+    // Converts the named attribute, naming the attribute and its node if it's missing or invalid
+    template<typename T>
+    static T Attribute(rapidxml::xml_node<char>* node, const char* name)
+    {
+        rapidxml::xml_attribute<char>* attr = node->first_attribute(name);
+        if (attr == nullptr) throw XMLValueError(std::string("Missing attribute ") + name + " in <" + node->name() + ">");
+
+        T ret;
+        if (!Parse(attr->value(), ret)) throw XMLValueError(std::string("Invalid value \"") + attr->value() + "\" for attribute " + name + " in <" + node->name() + ">");
+        return ret;
+    }
+
+    // Converts the text of a node such as <damage>3</damage>
+    template<typename T>
+    static T Value(rapidxml::xml_node<char>* node)
+    {
+        T ret;
+        if (!Parse(node->value(), ret)) throw XMLValueError(std::string("Invalid value \"") + node->value() + "\" in <" + node->name() + ">");
+        return ret;
+    }
+
+private:
+    static bool ParseInteger(const char* text, long long& out)
+    {
+        if (*text == '\0' || isspace((unsigned char)*text)) return false;
+        char* end;
+        errno = 0;
+        out = strtoll(text, &end, 10);
+        return errno == 0 && end != text && *end == '\0';
+    }
+};
@@ -38,6 +38,10 @@ class LuaLibScript
 
         void call_on_game_event_callbacks(std::string eventName, bool isLoading);
 
+        // Pushes a proxy for an object whose destructor hook runs HS_BREAK_TABLE.
+        // While Lua still holds the previous proxy for ptr with the same type it is pushed again instead of allocating a new userdata.
+        static void push_cached_pointer(lua_State* lua, void* ptr, swig_type_info* type);
+
         /*** Register a function to call upon loading your script
          * @function on_load
          * @tparam function callback Callback function to register
@@ -16,10 +16,20 @@ typedef int LuaFunctionRef;
     lua_rawsetp(L, LUA_REGISTRYINDEX, pointer);\
 
 
+// Registry field holding the weak table of proxies reused by LuaLibScript::push_cached_pointer
+#define HS_USERDATA_CACHE "HS_USERDATA_CACHE"
+
 #define HS_BREAK_TABLE(pointer)\
     auto L = G_->getLuaContext()->GetLua();\
     lua_pushnil(L);\
     lua_rawsetp(L, LUA_REGISTRYINDEX, pointer);\
+    lua_getfield(L, LUA_REGISTRYINDEX, HS_USERDATA_CACHE);\
+    if (lua_istable(L, -1))\
+    {\
+        lua_pushnil(L);\
+        lua_rawsetp(L, -2, pointer);\
+    }\
+    lua_pop(L, 1);\
 
 
 #endif // LUAINCLUDE_H_INCLUDED
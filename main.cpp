@@ -1,6 +1,7 @@
 #include "main.h"
 #include <stdio.h>
 #include "Global.h"
+#include "Profiler.h"
 
 // TODO: Add GCC poison pragma for some of the Windows specific bullshit functions & types so that we stop other devs from reintroducing them. https://gcc.gnu.org/onlinedocs/cpp/Pragmas.html#Pragmas (like sfopen!)
 // TODO: Add GCC dependency pragma to Lua parser for the FTLGame files to have GCC auto complain if you updated the ZHL files (if it's possible to match a whole folder, not sure)
@@ -27,7 +28,10 @@ extern "C" BOOL APIENTRY DllMain(HINSTANCE hinstDLL, DWORD fdwReason, LPVOID lpv
 
 
             ZHL::SetLogPath("zhl.log");
-            ZHL::Init();
+            {
+                HS_PROFILE_SCOPE("ZHL::Init");
+                ZHL::Init();
+            }
 
             G_->Initialize();
 
@@ -65,7 +69,10 @@ void __attribute__((constructor)) launchHyperspace() {
 #endif
 
             ZHL::SetLogPath("zhl.log");
-            ZHL::Init();
+            {
+                HS_PROFILE_SCOPE("ZHL::Init");
+                ZHL::Init();
+            }
 
             G_->Initialize();
 }
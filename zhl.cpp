@@ -300,6 +300,13 @@ int FunctionDefinition::Load()
 static FILE *g_hookLog = NULL;
 #endif
 
+// Hooks are installed from highest to lowest priority and every detour wraps the one before it,
+// so the lowest priority hook is entered first and each super() falls through to the next higher
+// priority until the original function is reached. On amd64 a hop is a jump through the detour
+// stub straight into the next hook; only the i386 build pays for the thiscall/userpurge
+// conversion in _internalHook/_internalSuper. Folding a function's hooks into one generated
+// dispatcher would need super() to carry its position in the chain, which changes the ABI that
+// every HOOK_* macro in zhl.h builds on, so the chained detours are kept.
 static std::multimap<int, FunctionHook_private*, std::greater<int>> &FuncHooks()
 {
 	static std::multimap<int, FunctionHook_private*, std::greater<int>> funcHooks;